@@ -23,4 +23,16 @@ typedef struct calibration_args {
 
 void Handle_Calibration_Step_Change(calibration_args_t* args);
 
+/**
+ * Load calibration stored by Save_Calibration from the reserved flash page.
+ * @return false if nothing valid is stored (blank, CRC mismatch or an older
+ * layout version), calibration_data is left untouched.
+ */
+bool Load_Calibration(calibration_data_t* calibration_data);
+
+/**
+ * Write calibration to the reserved flash page, replacing any stored copy.
+ */
+bool Save_Calibration(const calibration_data_t* calibration_data);
+
 }  // namespace SimpleSlam
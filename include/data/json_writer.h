@@ -0,0 +1,294 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <type_traits>
+
+#include "math/vector.h"
+
+namespace SimpleSlam {
+
+/**
+ * Streaming JSON writer into a caller-provided buffer. Values are written
+ * as they are added, with commas tracked per nesting level, so there is no
+ * heap, RTTI or intermediate tree. Output that would overflow the buffer is
+ * dropped and ok() turns false. The buffer is always NUL terminated.
+ *
+ * Numbers match the JSONBuilder visitors byte for byte: narrowed to float
+ * and printed with six decimals like std::to_string. Strings are quoted like
+ * std::quoted, only '"' and '\' are escaped.
+ *
+ * Types other than numbers, strings and Vector2 are written through a
+ * to_json(JSONWriter&, const T&) overload found by argument lookup.
+ */
+class JSONWriter {
+   public:
+    static constexpr size_t MAX_DEPTH = 32;
+    // Sign, the 39 integer digits of FLT_MAX, point and six decimals
+    static constexpr size_t MAX_NUMBER_LENGTH = 47;
+
+    constexpr JSONWriter(char* buffer, size_t capacity)
+        : _buffer{buffer}, _capacity{capacity} {
+        if (_capacity > 0) {
+            _buffer[0] = '\0';
+        }
+    }
+
+    constexpr JSONWriter& begin_object() {
+        separate();
+        put('{');
+        push();
+        return *this;
+    }
+
+    constexpr JSONWriter& end_object() {
+        pop();
+        put('}');
+        return *this;
+    }
+
+    constexpr JSONWriter& begin_array() {
+        separate();
+        put('[');
+        push();
+        return *this;
+    }
+
+    constexpr JSONWriter& end_array() {
+        pop();
+        put(']');
+        return *this;
+    }
+
+    constexpr JSONWriter& key(const char* name) {
+        separate();
+        write_string(name);
+        put(':');
+        _after_key = true;
+        return *this;
+    }
+
+    constexpr JSONWriter& value(const char* string) {
+        separate();
+        write_string(string);
+        return *this;
+    }
+
+    template <typename T>
+    constexpr JSONWriter& value(const T& value) {
+        if constexpr (std::is_integral_v<T>) {
+            separate();
+            write_integer(value);
+        } else if constexpr (std::is_floating_point_v<T>) {
+            separate();
+            write_float(static_cast<float>(value));
+        } else if constexpr (is_vector2<T>::value) {
+            begin_array();
+            this->value(value.get_x());
+            this->value(value.get_y());
+            end_array();
+        } else {
+            to_json(*this, value);
+        }
+        return *this;
+    }
+
+    template <typename T>
+    constexpr JSONWriter& field(const char* name, const T& value) {
+        key(name);
+        return this->value(value);
+    }
+
+    template <typename T>
+    constexpr JSONWriter& array(const T* items, size_t count) {
+        begin_array();
+        for (size_t i = 0; i < count; i++) {
+            value(items[i]);
+        }
+        return end_array();
+    }
+
+    /**
+     * Array of one member of each item, e.g. a column out of an array of
+     * structs, without copying it out first.
+     */
+    template <typename T, typename F>
+    constexpr JSONWriter& array(const T* items, size_t count, F project) {
+        begin_array();
+        for (size_t i = 0; i < count; i++) {
+            value(project(items[i]));
+        }
+        return end_array();
+    }
+
+    constexpr bool ok() const { return !_overflow && _depth == 0; }
+    constexpr size_t size() const { return _length; }
+    constexpr const char* c_str() const { return _buffer; }
+
+   private:
+    template <typename T>
+    struct is_vector2 : std::false_type {};
+    template <typename T>
+    struct is_vector2<Math::BasicVector2<T>> : std::true_type {};
+
+    constexpr void put(char c) {
+        if (_length + 1 >= _capacity) {
+            _overflow = true;
+            return;
+        }
+        _buffer[_length++] = c;
+        _buffer[_length] = '\0';
+    }
+
+    constexpr void put(const char* string) {
+        while (*string) {
+            put(*string++);
+        }
+    }
+
+    /** Comma before every value but the first at this level */
+    constexpr void separate() {
+        if (_after_key) {
+            _after_key = false;
+            return;
+        }
+        const uint32_t bit = (uint32_t)1 << (_depth % MAX_DEPTH);
+        if (_has_value & bit) {
+            put(',');
+        }
+        _has_value |= bit;
+    }
+
+    constexpr void push() {
+        if (_depth + 1 >= MAX_DEPTH) {
+            _overflow = true;
+        }
+        _depth++;
+        _has_value &= ~((uint32_t)1 << (_depth % MAX_DEPTH));
+    }
+
+    constexpr void pop() {
+        if (_depth == 0) {
+            _overflow = true;
+            return;
+        }
+        _depth--;
+    }
+
+    constexpr void write_string(const char* string) {
+        put('"');
+        for (; *string; string++) {
+            if (*string == '"' || *string == '\\') {
+                put('\\');
+            }
+            put(*string);
+        }
+        put('"');
+    }
+
+    template <typename T>
+    constexpr void write_integer(T value) {
+        if constexpr (std::is_same_v<T, bool>) {
+            put(value ? "true" : "false");
+        } else {
+            unsigned long long magnitude = value;
+            if constexpr (std::is_signed_v<T>) {
+                if (value < 0) {
+                    put('-');
+                    magnitude = 0ULL - (unsigned long long)value;
+                }
+            }
+            write_digits(magnitude, 1);
+        }
+    }
+
+    constexpr void write_digits(unsigned long long value, int min_digits) {
+        char digits[20] = {};
+        int count = 0;
+        do {
+            digits[count++] = '0' + value % 10;
+            value /= 10;
+        } while (value != 0 || count < min_digits);
+        while (count > 0) {
+            put(digits[--count]);
+        }
+    }
+
+    /**
+     * %f of a float. A float times 1e6 is exact in a double (24 + 14
+     * significant bits), so rounding it to an integer gives the same
+     * round-half-even result as printf. Past 8e12 the product no longer fits
+     * 64 bits, but floats that large are whole numbers and are printed from
+     * 32-bit limbs instead.
+     */
+    constexpr void write_float(float value) {
+        if (value != value) {
+            put("nan");
+            return;
+        }
+        if (value == 0 && 1 / value < 0) {
+            put("-0.000000");
+            return;
+        }
+        if (value < 0) {
+            put('-');
+        }
+        const double magnitude = value < 0 ? -(double)value : (double)value;
+        if (magnitude > 3.5e38) {
+            put("inf");
+            return;
+        }
+
+        if (magnitude < 8e12) {
+            const double scaled = magnitude * 1e6;
+            unsigned long long whole = (unsigned long long)scaled;
+            const double remainder = scaled - (double)whole;
+            if (remainder > 0.5 || (remainder == 0.5 && (whole & 1))) {
+                whole++;
+            }
+            write_digits(whole / 1000000, 1);
+            put('.');
+            write_digits(whole % 1000000, 6);
+            return;
+        }
+
+        uint32_t limbs[4] = {};
+        double rest = magnitude;
+        for (int i = 3; i >= 0; i--) {
+            // 2^(32 i), split so the shift stays under 64 bits
+            const double limb_scale =
+                (double)(1ULL << (16 * i)) * (double)(1ULL << (16 * i));
+            limbs[i] = (uint32_t)(rest / limb_scale);
+            rest -= (double)limbs[i] * limb_scale;
+        }
+        char digits[40] = {};
+        int count = 0;
+        bool nonzero = true;
+        while (nonzero) {
+            uint64_t carry = 0;
+            nonzero = false;
+            for (int i = 3; i >= 0; i--) {
+                const uint64_t current = (carry << 32) | limbs[i];
+                limbs[i] = (uint32_t)(current / 10);
+                carry = current % 10;
+                nonzero = nonzero || limbs[i] != 0;
+            }
+            digits[count++] = '0' + carry;
+        }
+        while (count > 0) {
+            put(digits[--count]);
+        }
+        put(".000000");
+    }
+
+    char* _buffer;
+    size_t _capacity;
+    size_t _length = 0;
+    size_t _depth = 0;
+    uint32_t _has_value = 0;
+    bool _after_key = false;
+    bool _overflow = false;
+};
+
+}  // namespace SimpleSlam
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "math/vector.h"
+
+namespace SimpleSlam {
+
+/**
+ * Binary /api/collect body, sent as application/octet-stream. All fields
+ * are little endian.
+ *
+ *   0  char[4]  magic "SLPB"
+ *   4  uint8    version
+ *   5  uint8    PointEncoding
+ *   6  uint16   point count N
+ *   8  uint32   board uptime in ms when the batch was sent
+ *  12  uint8    board id length L
+ *  13  char[L]  board id
+ *      N spatial (x, y) pairs, then N position (x, y) pairs, in cm
+ *
+ * With DELTA_VARINT_CM each stream (spatials, positions) starts with a
+ * keyframe pair holding the absolute position, every later pair holds the
+ * difference from the pair before it. Values are zigzag mapped so small
+ * negative deltas stay small, then written as LEB128 varints, 7 bits a
+ * byte. A few cm of movement between points costs one byte per axis.
+ *
+ * Decoded by decodePointBatch in server/internal/api/batch.go.
+ */
+#define POINT_BATCH_MAGIC "SLPB"
+#define POINT_BATCH_VERSION 1
+#define POINT_BATCH_HEADER_SIZE 13
+
+enum class PointEncoding : uint8_t {
+    // float32 x, y
+    FLOAT32 = 0,
+    // int16 x, y rounded to whole cm, saturating at +-327 m
+    INT16_CM = 1,
+    // Whole cm, zigzag varint deltas from the previous pair in the stream
+    DELTA_VARINT_CM = 2,
+};
+
+/**
+ * Writes one point batch into a caller-provided buffer. Call header() once,
+ * then point() for every spatial point followed by every position point.
+ */
+class PointBatchWriter {
+   public:
+    PointBatchWriter(uint8_t* buffer, size_t capacity,
+                     PointEncoding encoding = PointEncoding::INT16_CM)
+        : _buffer{buffer}, _capacity{capacity}, _encoding{encoding} {}
+
+    /** Largest encoded (x, y) pair, varints take up to 5 bytes an axis */
+    static constexpr size_t Max_Pair_Size(PointEncoding encoding) {
+        return encoding == PointEncoding::FLOAT32   ? 8
+               : encoding == PointEncoding::INT16_CM ? 4
+                                                     : 10;
+    }
+
+    /** Worst case bytes for count spatial and count position points */
+    static constexpr size_t Max_Size(size_t board_id_length, size_t count,
+                                     PointEncoding encoding) {
+        return POINT_BATCH_HEADER_SIZE + board_id_length +
+               2 * count * Max_Pair_Size(encoding);
+    }
+
+    PointBatchWriter& header(const char* board_id, uint32_t timestamp_ms,
+                             uint16_t count) {
+        const size_t board_id_length = strlen(board_id);
+        if (board_id_length > UINT8_MAX) {
+            _overflow = true;
+            return *this;
+        }
+
+        _expected_pairs = 2 * (size_t)count;
+        put_bytes(POINT_BATCH_MAGIC, 4);
+        put_u8(POINT_BATCH_VERSION);
+        put_u8((uint8_t)_encoding);
+        put_u16(count);
+        put_u32(timestamp_ms);
+        put_u8((uint8_t)board_id_length);
+        put_bytes(board_id, board_id_length);
+        return *this;
+    }
+
+    template <typename T>
+    PointBatchWriter& point(const Math::BasicVector2<T>& point) {
+        if (_encoding == PointEncoding::FLOAT32) {
+            put_float((float)point.get_x());
+            put_float((float)point.get_y());
+        } else if (_encoding == PointEncoding::INT16_CM) {
+            put_u16((uint16_t)to_cm(point.get_x(), INT16_MAX));
+            put_u16((uint16_t)to_cm(point.get_y(), INT16_MAX));
+        } else {
+            // Keyframe at the start of the spatial and position streams
+            if (_pairs == 0 || _pairs == _expected_pairs / 2) {
+                _previous_x = 0;
+                _previous_y = 0;
+            }
+            const int32_t x = to_cm(point.get_x(), _MAX_DELTA_CM);
+            const int32_t y = to_cm(point.get_y(), _MAX_DELTA_CM);
+            put_varint(zigzag(x - _previous_x));
+            put_varint(zigzag(y - _previous_y));
+            _previous_x = x;
+            _previous_y = y;
+        }
+        _pairs++;
+        return *this;
+    }
+
+    bool ok() const { return !_overflow && _pairs == _expected_pairs; }
+    size_t size() const { return _length; }
+    const uint8_t* data() const { return _buffer; }
+
+   private:
+    // Keeps the difference of two clamped values inside int32, 2^30 itself
+    // would let a swing from -2^30 to 2^30 reach 2^31
+    static constexpr int32_t _MAX_DELTA_CM = ((int32_t)1 << 30) - 1;
+
+    /** Round to whole cm, saturating at +-limit */
+    static int32_t to_cm(double value, int32_t limit) {
+        if (value >= limit) {
+            return limit;
+        }
+        if (value <= -limit) {
+            return -limit;
+        }
+        return (int32_t)(value < 0 ? value - 0.5 : value + 0.5);
+    }
+
+    /** 0, -1, 1, -2, 2 ... to 0, 1, 2, 3, 4 ... */
+    static uint32_t zigzag(int32_t value) {
+        return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+    }
+
+    void put_bytes(const void* bytes, size_t length) {
+        if (_length + length > _capacity) {
+            _overflow = true;
+            return;
+        }
+        memcpy(_buffer + _length, bytes, length);
+        _length += length;
+    }
+
+    void put_u8(uint8_t value) { put_bytes(&value, 1); }
+
+    void put_u16(uint16_t value) {
+        const uint8_t bytes[2] = {(uint8_t)value, (uint8_t)(value >> 8)};
+        put_bytes(bytes, sizeof(bytes));
+    }
+
+    void put_u32(uint32_t value) {
+        const uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8),
+                                  (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+        put_bytes(bytes, sizeof(bytes));
+    }
+
+    void put_varint(uint32_t value) {
+        while (value >= 0x80) {
+            put_u8((uint8_t)(value | 0x80));
+            value >>= 7;
+        }
+        put_u8((uint8_t)value);
+    }
+
+    void put_float(float value) {
+        uint32_t bits;
+        memcpy(&bits, &value, sizeof(bits));
+        put_u32(bits);
+    }
+
+    uint8_t* _buffer;
+    size_t _capacity;
+    PointEncoding _encoding;
+    size_t _length = 0;
+    size_t _pairs = 0;
+    size_t _expected_pairs = 0;
+    int32_t _previous_x = 0;
+    int32_t _previous_y = 0;
+    bool _overflow = false;
+};
+
+}  // namespace SimpleSlam
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+
+namespace SimpleSlam {
+
+/**
+ * Lock-free single-writer snapshot (sequence lock). The writer never waits,
+ * readers retry if a publish lands while they are copying.
+ */
+template <typename T>
+class Snapshot {
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "Snapshot values are copied while the writer may be active");
+
+   public:
+    /**
+     * Publish a new value. Only one thread (or interrupt) may ever call this.
+     */
+    void publish(const T& value) {
+        const uint32_t sequence = _sequence.load(std::memory_order_relaxed);
+        // Odd sequence marks a write in progress
+        _sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _value = value;
+        _sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Copy out the latest published value, safe from any thread.
+     */
+    T read() const {
+        T value;
+        uint32_t before;
+        uint32_t after;
+        do {
+            before = _sequence.load(std::memory_order_acquire);
+            value = _value;
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = _sequence.load(std::memory_order_relaxed);
+        } while ((before & 1) != 0 || before != after);
+        return value;
+    }
+
+    /**
+     * Number of values published so far.
+     */
+    uint32_t count() const {
+        return _sequence.load(std::memory_order_acquire) / 2;
+    }
+
+   private:
+    std::atomic<uint32_t> _sequence{0};
+    T _value{};
+};
+
+}  // namespace SimpleSlam
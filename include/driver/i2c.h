@@ -5,6 +5,8 @@
 
 #include "stm32l4xx_hal.h"
 #include "stm32l4xx_hal_rcc.h"
+#include <stddef.h>
+#include "driver/i2c_timing.h"
 
 namespace SimpleSlam {
 
@@ -20,15 +22,10 @@ namespace SimpleSlam {
 #define ADDR_SIZE_32  4U
 
 /**
- * @brief I2C Timing Register Value
- * @note STM32L475 MCU Reference Manual - 39.4.10 Standard-Mode @ 100kHz
+ * @brief I2C kernel clock used to compute TIMINGR
 */
-#define SCLL          (0x13 << 0)
-#define SCLH          (0x0F << 8)
-#define SDADEL        (0x2 << 16)
-#define SCLDEL        (0x4 << 20)
-#define PRESC         (0x1 << 28)
-#define I2C_TIMINGR   (PRESC | SCLDEL | SDADEL | SCLH | SCLL)
+#define INTERNAL_I2C_PERIPHCLK      RCC_PERIPHCLK_I2C2
+#define INTERNAL_I2C_FASTMODEPLUS   I2C_FASTMODEPLUS_I2C2
 
 /**
  * @brief 
@@ -45,12 +42,48 @@ namespace SimpleSlam {
 #define INTERNAL_I2C_FORCE_RESET()    __HAL_RCC_I2C2_FORCE_RESET()
 #define INTERNAL_I2C_RELEASE_RESET()  __HAL_RCC_I2C2_RELEASE_RESET()
 
+/**
+ * @brief Initialize the bus at the given speed, TIMINGR is computed from the
+ * current I2C kernel clock.
+*/
+void I2C_Init(I2CSpeed speed);
+
+/**
+ * @brief Re-initialize the bus at the last configured speed (Standard-mode if
+ * it has not been configured yet).
+*/
 void I2C_Init();
 void I2C_DeInit();
 
+/**
+ * @brief Handle of the shared sensor bus (I2C2), used by the async DMA engine
+*/
+I2C_HandleTypeDef* I2C_Get_Handle();
+
+/**
+ * @brief A single register write, used to record fixed register sequences
+ * once and replay them.
+*/
+typedef struct {
+    uint8_t reg_address;
+    uint8_t value;
+} i2c_register_write_t;
+
+/**
+ * @brief Total bus transactions issued since boot, blocking and async
+*/
+uint32_t I2C_Get_Transaction_Count();
+void I2C_Count_Transaction();
+
 HAL_StatusTypeDef I2C_Mem_Write(uint16_t peripheral_address, uint16_t reg_address, uint16_t reg_address_size, uint8_t *buffer, uint16_t size);
 HAL_StatusTypeDef I2C_Mem_Write_Single(uint16_t peripheral_address, uint16_t reg_address, uint8_t value);
 HAL_StatusTypeDef I2C_Mem_Read(uint16_t peripheral_address, uint16_t reg_address, uint16_t reg_address_size, uint8_t *buffer, uint16_t size);
 HAL_StatusTypeDef I2C_Mem_Read_Single(uint16_t peripheral_address, uint16_t reg_address, uint8_t* buffer);
 
+/**
+ * @brief Replay a prepared sequence of single register writes, stopping at
+ * the first failure.
+*/
+HAL_StatusTypeDef I2C_Write_Sequence(uint16_t peripheral_address, const i2c_register_write_t* writes, size_t count);
+
 }
@@ -0,0 +1,84 @@
+/**
+ * Asynchronous I2C Library
+ *
+ * Queues memory read/write transactions on the sensor bus (I2C2) and runs
+ * them back-to-back with DMA, so the CPU is free while bytes are on the wire.
+*/
+#pragma once
+
+#include "driver/i2c.h"
+#include "mbed.h"
+
+namespace SimpleSlam {
+
+#define I2C_ASYNC_QUEUE_SIZE 8
+#define I2C_ASYNC_WAIT_FOREVER 0xFFFFFFFFU
+
+/**
+ * @brief DMA channels serving I2C2
+ * @note STM32L475 MCU Reference Manual - DMA1 request mapping (request 3)
+*/
+#define I2C_DMA_CLK_ENABLE()    __HAL_RCC_DMA1_CLK_ENABLE()
+#define I2C_DMA_REQUEST         DMA_REQUEST_3
+#define I2C_DMA_RX_CHANNEL      DMA1_Channel5
+#define I2C_DMA_RX_IRQN         DMA1_Channel5_IRQn
+#define I2C_DMA_TX_CHANNEL      DMA1_Channel4
+#define I2C_DMA_TX_IRQN         DMA1_Channel4_IRQn
+#define I2C_EV_IRQN             I2C2_EV_IRQn
+#define I2C_ER_IRQN             I2C2_ER_IRQn
+
+enum class I2CTransactionType {
+    READ,
+    WRITE,
+};
+
+/**
+ * @brief A single memory transfer. The caller owns the transaction and its
+ * buffer until it has completed.
+*/
+typedef struct i2c_transaction {
+    I2CTransactionType type;
+    uint16_t peripheral_address;
+    uint16_t reg_address;
+    uint16_t reg_address_size;
+    uint8_t* buffer;
+    uint16_t size;
+
+    // Completion notification, both optional. The callback runs in interrupt
+    // context, EventFlags::set is safe to use from there.
+    mbed::Callback<void(struct i2c_transaction*)> on_complete;
+    EventFlags* flags;
+    uint32_t flag_mask;
+
+    volatile HAL_StatusTypeDef status;
+    volatile bool done;
+} i2c_transaction_t;
+
+/**
+ * Set up DMA channels and interrupt vectors. I2C_Init must be called first.
+*/
+void I2C_Async_Init();
+void I2C_Async_DeInit();
+
+/**
+ * Queue a transaction, it starts immediately if the bus is idle.
+ * Returns HAL_BUSY if the queue is full.
+*/
+HAL_StatusTypeDef I2C_Async_Submit(i2c_transaction_t* transaction);
+
+/**
+ * Wait for a submitted transaction to complete and return its status.
+ * Sleeps on the transaction flags when present, otherwise polls.
+*/
+HAL_StatusTypeDef I2C_Async_Wait(i2c_transaction_t* transaction, uint32_t timeout_ms = I2C_ASYNC_WAIT_FOREVER);
+
+bool I2C_Async_Is_Idle();
+
+/**
+ * Drop-in replacement for I2C_Mem_Read that sleeps the calling thread while
+ * the DMA transfer runs instead of spinning. Falls back to the blocking read
+ * when the async engine has not been initialized.
+*/
+HAL_StatusTypeDef I2C_Async_Mem_Read(uint16_t peripheral_address, uint16_t reg_address, uint16_t reg_address_size, uint8_t *buffer, uint16_t size);
+
+}
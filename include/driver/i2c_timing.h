@@ -0,0 +1,160 @@
+/**
+ * I2C Timing Calculation
+ *
+ * Computes the TIMINGR register value for a bus speed from the I2C kernel
+ * clock. Kept free of HAL includes so it can be evaluated on the host.
+*/
+#pragma once
+
+#include <stdint.h>
+
+namespace SimpleSlam {
+
+enum class I2CSpeed {
+    STANDARD_100KHZ,
+    FAST_400KHZ,
+    FAST_PLUS_1MHZ,
+};
+
+/**
+ * @brief I2C bus characteristics, all times in nanoseconds
+ * @note UM10204 I2C-bus specification - Table 10, rise and fall times are the
+ * values expected on this bus rather than the specification maxima.
+*/
+typedef struct {
+    uint32_t frequency_hz;
+    uint32_t low_min_ns;    // tLOW
+    uint32_t high_min_ns;   // tHIGH
+    uint32_t rise_ns;       // tr
+    uint32_t fall_ns;       // tf
+    uint32_t hold_min_ns;   // tHD;DAT
+    uint32_t valid_max_ns;  // tVD;DAT
+    uint32_t setup_min_ns;  // tSU;DAT
+} i2c_bus_spec_t;
+
+/**
+ * @brief Analog filter delay (tAF) with the analog filter enabled
+*/
+#define I2C_ANALOG_FILTER_MIN_NS 50
+#define I2C_ANALOG_FILTER_MAX_NS 90
+
+#define I2C_TIMINGR_PRESC_MAX   15
+#define I2C_TIMINGR_SCLDEL_MAX  15
+#define I2C_TIMINGR_SDADEL_MAX  15
+#define I2C_TIMINGR_SCL_MAX     255
+
+constexpr i2c_bus_spec_t I2C_Bus_Spec(I2CSpeed speed) {
+    switch (speed) {
+        case I2CSpeed::FAST_400KHZ:
+            return {400000, 1300, 600, 300, 300, 0, 900, 100};
+        case I2CSpeed::FAST_PLUS_1MHZ:
+            return {1000000, 500, 260, 120, 120, 0, 450, 50};
+        case I2CSpeed::STANDARD_100KHZ:
+        default:
+            return {100000, 4700, 4000, 1000, 300, 0, 3450, 250};
+    }
+}
+
+/**
+ * @brief Smallest n such that n * step >= value (0 for non-positive values)
+*/
+constexpr int64_t I2C_Ceil_Div(int64_t value, int64_t step) {
+    return value <= 0 ? 0 : (value + step - 1) / step;
+}
+
+/**
+ * @brief Compute TIMINGR for a bus speed from the I2C kernel clock.
+ * @note STM32L475 MCU Reference Manual - 39.4.10 I2C master mode, SDADEL and
+ * SCLDEL constraints. Picks the smallest prescaler that fits every field.
+ * @return TIMINGR value, or 0 if the kernel clock cannot reach the speed.
+*/
+constexpr uint32_t I2C_Compute_Timing(uint32_t clock_hz, I2CSpeed speed) {
+    const i2c_bus_spec_t spec = I2C_Bus_Spec(speed);
+
+    // Work in picoseconds so 80MHz (12.5ns) stays exact
+    const int64_t clock_ps = 1000000000000LL / clock_hz;
+    const int64_t period_ps = 1000000000000LL / spec.frequency_hz;
+    const int64_t filter_min_ps = I2C_ANALOG_FILTER_MIN_NS * 1000LL;
+    const int64_t filter_max_ps = I2C_ANALOG_FILTER_MAX_NS * 1000LL;
+
+    // SCL edge detection goes through the analog filter plus ~3 kernel clocks
+    // on each edge, the rest of the period is split between SCLL and SCLH in
+    // the ratio of their minimums. Rounding SCLL and SCLH up keeps the rate at
+    // or below the requested one.
+    const int64_t sync_ps = 2 * filter_min_ps + 6 * clock_ps;
+    const int64_t scl_ps = period_ps - sync_ps;
+    int64_t low_ps = scl_ps * spec.low_min_ns / (spec.low_min_ns + spec.high_min_ns);
+    int64_t high_ps = scl_ps - low_ps;
+
+    // The bus sees SCLL and SCLH stretched by the synchronization of the
+    // edge that ends them, which is at least the filter delay and 2 kernel
+    // clocks. Only that much counts towards tLOW and tHIGH.
+    const int64_t sync_min_ps = filter_min_ps + 2 * clock_ps;
+    if (low_ps < spec.low_min_ns * 1000LL - sync_min_ps) {
+        low_ps = spec.low_min_ns * 1000LL - sync_min_ps;
+    }
+    if (high_ps < spec.high_min_ns * 1000LL - sync_min_ps) {
+        high_ps = spec.high_min_ns * 1000LL - sync_min_ps;
+    }
+
+    for (int64_t presc = 0; presc <= I2C_TIMINGR_PRESC_MAX; presc++) {
+        const int64_t presc_ps = (presc + 1) * clock_ps;
+
+        int64_t scldel = I2C_Ceil_Div((spec.rise_ns + spec.setup_min_ns) * 1000LL, presc_ps) - 1;
+        scldel = scldel < 0 ? 0 : scldel;
+
+        const int64_t sdadel_min = I2C_Ceil_Div(
+            (spec.fall_ns + spec.hold_min_ns) * 1000LL - filter_min_ps - 3 * clock_ps, presc_ps);
+        const int64_t sdadel_max_ps =
+            (spec.valid_max_ns - spec.rise_ns) * 1000LL - filter_max_ps - 4 * clock_ps;
+
+        const int64_t scll = I2C_Ceil_Div(low_ps, presc_ps) - 1;
+        const int64_t sclh = I2C_Ceil_Div(high_ps, presc_ps) - 1;
+
+        if (scldel > I2C_TIMINGR_SCLDEL_MAX || sdadel_min > I2C_TIMINGR_SDADEL_MAX ||
+            sdadel_max_ps < sdadel_min * presc_ps ||
+            scll > I2C_TIMINGR_SCL_MAX || sclh > I2C_TIMINGR_SCL_MAX) {
+            continue;
+        }
+
+        return (uint32_t)((presc << 28) | (scldel << 20) | (sdadel_min << 16) | (sclh << 8) | scll);
+    }
+    return 0;
+}
+
+typedef struct {
+    uint32_t clock_hz;
+    I2CSpeed speed;
+    uint32_t timingr;
+} i2c_timing_entry_t;
+
+/**
+ * @brief Precomputed timings for common kernel clocks
+ * @note Fast-mode Plus cannot meet tVD;DAT with the analog filter enabled at
+ * 16MHz and below, so those kernel clocks only list the slower modes.
+*/
+inline constexpr i2c_timing_entry_t I2C_TIMING_TABLE[] = {
+    {8000000, I2CSpeed::STANDARD_100KHZ, I2C_Compute_Timing(8000000, I2CSpeed::STANDARD_100KHZ)},
+    {8000000, I2CSpeed::FAST_400KHZ, I2C_Compute_Timing(8000000, I2CSpeed::FAST_400KHZ)},
+    {16000000, I2CSpeed::STANDARD_100KHZ, I2C_Compute_Timing(16000000, I2CSpeed::STANDARD_100KHZ)},
+    {16000000, I2CSpeed::FAST_400KHZ, I2C_Compute_Timing(16000000, I2CSpeed::FAST_400KHZ)},
+    {48000000, I2CSpeed::STANDARD_100KHZ, I2C_Compute_Timing(48000000, I2CSpeed::STANDARD_100KHZ)},
+    {48000000, I2CSpeed::FAST_400KHZ, I2C_Compute_Timing(48000000, I2CSpeed::FAST_400KHZ)},
+    {48000000, I2CSpeed::FAST_PLUS_1MHZ, I2C_Compute_Timing(48000000, I2CSpeed::FAST_PLUS_1MHZ)},
+    {80000000, I2CSpeed::STANDARD_100KHZ, I2C_Compute_Timing(80000000, I2CSpeed::STANDARD_100KHZ)},
+    {80000000, I2CSpeed::FAST_400KHZ, I2C_Compute_Timing(80000000, I2CSpeed::FAST_400KHZ)},
+    {80000000, I2CSpeed::FAST_PLUS_1MHZ, I2C_Compute_Timing(80000000, I2CSpeed::FAST_PLUS_1MHZ)},
+};
+
+constexpr bool I2C_Timing_Table_Is_Valid() {
+    for (const auto& entry : I2C_TIMING_TABLE) {
+        if (entry.timingr == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static_assert(I2C_Timing_Table_Is_Valid(), "Every tabulated kernel clock must reach its bus speed");
+
+}
@@ -9,6 +9,7 @@
 #include <string>
 
 #include "driver/i2c.h"
+#include "mbed.h"
 
 namespace SimpleSlam::LIS3MDL {
 
@@ -17,6 +18,9 @@ namespace SimpleSlam::LIS3MDL {
 #define LIS3MDL_WHO_AM_I 0x0F   // h
 #define WHO_AM_I_EXPECTED 0x3D  // 61
 
+// Setting the MSB of the sub-address auto-increments it for multi-byte reads
+#define LIS3MDL_AUTO_INCREMENT 0x80
+
 // X Y Z Map
 #define REG_X_L 0x28
 #define REG_X_H 0x29
@@ -72,4 +76,26 @@ std::optional<error_t> Init(const LIS3MDL_Config_t& config);
 std::optional<error_t> DeInit();
 std::optional<error_t> ReadXYZ(int16_t& x, int16_t& y, int16_t& z);
 
+/**
+ * Raw output counts, divide by Get_Sensitivity() for gauss.
+ */
+std::optional<error_t> ReadXYZ_Raw(int16_t& x, int16_t& y, int16_t& z);
+
+/**
+ * Sensitivity in LSB/gauss for the full scale configured at Init.
+ */
+uint16_t Get_Sensitivity();
+
+/**
+ * Queue an XYZ read on the async I2C engine and return without waiting.
+ * on_complete runs in interrupt context once the transfer has finished, the
+ * reading is then collected with Get_XYZ. Returns HAL_BUSY while an earlier
+ * read has not been collected.
+ */
+HAL_StatusTypeDef Submit_Read_XYZ(mbed::Callback<void()> on_complete);
+/**
+ * Collect the reading queued by Submit_Read_XYZ in milligauss.
+ */
+std::optional<error_t> Get_XYZ(int16_t& x, int16_t& y, int16_t& z);
+
 }  // namespace SimpleSlam::LIS3MDL
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "stm32l4xx_hal.h"
+#include "mbed.h"
 #include <utility>
 #include <string>
 #include <optional>
@@ -11,6 +12,7 @@ namespace SimpleSlam::LSM6DSL {
 enum class ErrorCode {
     I2C_ERROR = 1,
     WHO_AM_I_UNEXPECTED_VALUE = 2,
+    INVALID_CONFIG = 3,
 };
 
 typedef std::pair<ErrorCode, std::string> error_t;
@@ -43,6 +45,11 @@ typedef std::pair<ErrorCode, std::string> error_t;
 #define GYRO_READ_REG_Z_HIGH 0x27
 #define GYRO_BUFFER_SIZE 6 // Reads 6 8-bit ints and stores as 3 16-bit ints
 
+// Gyro (0x22-0x27) and accel (0x28-0x2D) outputs are contiguous, so both can
+// be fetched with one auto-increment read starting at the gyro X low byte.
+#define IMU_READ_REG_START GYRO_READ_REG_X_LOW
+#define IMU_BUFFER_SIZE (GYRO_BUFFER_SIZE + ACCEL_BUFFER_SIZE)
+
 
 // Control registers - LSM6DSL data sheet pg. 49
 #define CTRL_1_REG 0x10
@@ -90,6 +97,58 @@ typedef std::pair<ErrorCode, std::string> error_t;
 // Control Options for Ctrl 3 - LSM6DSL data sheet pg. 62
 #define ACCEL_SW_RESET 0x01
 
+// FIFO registers - LSM6DSL data sheet pg. 49
+#define FIFO_CTRL_1_REG 0x06
+#define FIFO_CTRL_2_REG 0x07
+#define FIFO_CTRL_3_REG 0x08
+#define FIFO_CTRL_5_REG 0x0A
+#define FIFO_STATUS_1_REG 0x3A
+#define FIFO_STATUS_SIZE 4 // FIFO_STATUS1-4 read in one go
+#define FIFO_DATA_OUT_L_REG 0x3E
+
+// Control Options for FIFO_CTRL3 - LSM6DSL data sheet pg. 55
+// Bit[0:2]: Accelerometer decimation, Bit[3:5]: Gyroscope decimation
+#define FIFO_DEC_NOT_IN_FIFO 0x00
+#define FIFO_DEC_NONE 0x01
+#define FIFO_DEC_2 0x02
+#define FIFO_DEC_3 0x03
+#define FIFO_DEC_4 0x04
+#define FIFO_DEC_8 0x05
+#define FIFO_DEC_16 0x06
+#define FIFO_DEC_32 0x07
+#define FIFO_GYRO_DEC_SHIFT 3
+
+// Control Options for FIFO_CTRL5 - LSM6DSL data sheet pg. 57
+// Bit[0:2]: FIFO mode
+// Bit[3:6]: FIFO ODR, 12.5Hz roughly doubling up to 6.66kHz
+#define FIFO_MODE_BYPASS 0x00
+#define FIFO_MODE_CONTINUOUS 0x06
+#define FIFO_ODR_12_5HZ (0x01 << 3)
+#define FIFO_ODR_26HZ (0x02 << 3)
+#define FIFO_ODR_52HZ (0x03 << 3)
+#define FIFO_ODR_104HZ (0x04 << 3)
+#define FIFO_ODR_208HZ (0x05 << 3)
+#define FIFO_ODR_416HZ (0x06 << 3)
+#define FIFO_ODR_833HZ (0x07 << 3)
+#define FIFO_ODR_1660HZ (0x08 << 3)
+#define FIFO_ODR_3330HZ (0x09 << 3)
+#define FIFO_ODR_6660HZ (0x0A << 3)
+#define FIFO_ODR_MASK 0x78
+
+// FIFO_STATUS2 - LSM6DSL data sheet pg. 80
+#define FIFO_STATUS_2_DIFF_MASK 0x07
+#define FIFO_STATUS_4_PATTERN_MASK 0x03
+
+// Control Options for INT1_CTRL - LSM6DSL data sheet pg. 59
+#define INT1_CTRL_REG 0x0D
+#define INT1_DRDY_XL 0x01
+#define INT1_DRDY_G 0x02
+#define INT1_FTH 0x08 // FIFO threshold reached
+
+// Gyro X/Y/Z followed by accel X/Y/Z when both share the same decimation
+#define FIFO_WORDS_PER_SAMPLE 6
+#define FIFO_MAX_BATCH_SIZE 32 // Samples drained per FIFO_Read_Batch call
+
 // Control Options for Ctrl 8 - LSM6DSL data sheet pg. 66
 // Bit[0]: Enable LPF2
 // Bit[1:3]: The threshold for low-pass filter
@@ -98,6 +157,25 @@ typedef std::pair<ErrorCode, std::string> error_t;
 #define ACCEL_LPF2_CUTOFF 0x60 // Low-pass cutoff: ODR/400
 #define HP_SLOPE_XL_EN 0x00 // Use Low-pass
 
+/**
+ * Gyroscope and accelerometer sample taken from the same output register set
+*/
+typedef struct {
+    int16_t gyro[3];     // dps (sensitivity applied)
+    int16_t accel[3];    // mg (sensitivity applied)
+    uint32_t timestamp_us;
+} imu_sample_t;
+
+/**
+ * FIFO configuration. Gyro and accel use the same decimation so that the FIFO
+ * pattern always holds complete gyro + accel pairs.
+*/
+typedef struct {
+    uint8_t odr;         // FIFO_ODR_* (must not exceed the sensor ODR)
+    uint8_t decimation;  // FIFO_DEC_* applied to both gyro and accel
+    uint16_t threshold;  // Watermark in samples
+} fifo_config_t;
+
 /**
  * Write configuration settings to Accelerometer control register
 */
@@ -130,4 +208,54 @@ std::optional<error_t> Gyro_Read_Raw(uint8_t* buffer);
 */
 std::optional<error_t> Gyro_Read(int16_t* buffer);
 
+/**
+ * Read raw gyroscope and accelerometer data into buffer with a single
+ * auto-increment transaction. Gyro bytes come first, followed by accel.
+*/
+std::optional<error_t> IMU_Read_Raw(uint8_t* buffer);
+/**
+ * Read gyroscope (dps) and accelerometer (mg) data in one transaction
+ * Both vectors share the timestamp taken when the read completed
+*/
+std::optional<error_t> Read_IMU(imu_sample_t& sample);
+
+/**
+ * Configure the FIFO decimation and ODR and start it in continuous mode
+ * Accel_Init and Gyro_Init must have been called beforehand
+ * Returns INVALID_CONFIG for an ODR of 0 (FIFO off) or samples left out of the FIFO
+*/
+std::optional<error_t> FIFO_Init(const fifo_config_t& config);
+std::optional<error_t> FIFO_DeInit();
+
+/**
+ * Route interrupt sources (INT1_*) to the INT1 pin, active high
+*/
+std::optional<error_t> INT1_Init(uint8_t sources);
+
+/**
+ * Drain up to max_samples gyro + accel pairs (oldest first) from the FIFO with
+ * a single burst read. Timestamps follow each sample's place in the stream,
+ * with the period tracked from when successive drains found the FIFO filled.
+*/
+std::optional<error_t> FIFO_Read_Batch(imu_sample_t* samples, size_t max_samples, size_t& num_samples);
+
+/**
+ * Queue a FIFO drain on the async I2C engine and return without waiting. The
+ * status read chains the burst read from its completion, so both run
+ * back-to-back with whatever else is queued. on_complete runs in interrupt
+ * context once the batch is in, it is then collected with FIFO_Get_Batch.
+ * Returns HAL_BUSY while an earlier batch has not been collected.
+*/
+HAL_StatusTypeDef FIFO_Submit_Read_Batch(mbed::Callback<void()> on_complete);
+/**
+ * Collect the batch queued by FIFO_Submit_Read_Batch, samples must have room
+ * for FIFO_MAX_BATCH_SIZE.
+*/
+std::optional<error_t> FIFO_Get_Batch(imu_sample_t* samples, size_t& num_samples);
+
+/**
+ * Nominal time between two consecutive FIFO samples in microseconds
+*/
+uint32_t FIFO_Get_Sample_Period_Us();
+
 }
@@ -8,6 +8,7 @@
 #include <string>
 #include <optional>
 #include "driver/i2c.h"
+#include "mbed.h"
 
 namespace SimpleSlam::VL53L0X {
 /** 
@@ -24,10 +25,10 @@ namespace SimpleSlam::VL53L0X {
 #define VL53L0X_EXPECTED_WHO_AM_I_VALUE	        0xEE
 
 #define SYSRANGE_START	            0x00
-// SYSRANGE_START[0] 
-#define SYSRANGE_MODE_START_STOP    0x0
+// SYSRANGE_START[0] starts a measurement, or stops continuous ranging
+#define SYSRANGE_MODE_START_STOP    0x1
 // SYSRANGE_START[1] 
-#define SYSRANGE_MODE_SINGLESHOT    (0x1 << 1)
+#define SYSRANGE_MODE_SINGLESHOT    0x0
 #define SYSRANGE_MODE_BACK_TO_BACK  (0x1 << 1)
 // SYSRANGE_START[2] 
 #define SYSRANGE_MODE_TIMED         (0x1 << 2)
@@ -161,6 +162,42 @@ std::optional<error_t> Get_Measurement_Timing_Budget(uint32_t& budget);
 std::optional<error_t> Set_Measurement_Timing_Budget(uint32_t budget);
 std::optional<error_t> Set_Vcsel_Pulse_Period(VcselPulsePeriod period, uint8_t pclks, uint32_t current_measurement_budget);
 std::optional<error_t> Perform_Single_Shot_Read(uint16_t& distance);
+/**
+ * Non-blocking halves of Perform_Single_Shot_Read. Start_Single_Shot kicks off
+ * a measurement and returns, GPIO1 goes low once the result is ready, and
+ * Read_Range_Result fetches it and clears the interrupt.
+*/
+std::optional<error_t> Start_Single_Shot();
+std::optional<error_t> Read_Range_Result(uint16_t& distance);
+
+/**
+ * Continuous ranging. With period_ms = 0 the sensor ranges back-to-back,
+ * otherwise it starts a new measurement every period_ms (must be longer than
+ * the timing budget). Results are signalled on GPIO1 and fetched with
+ * Read_Range_Result, or polled with Try_Read_Range.
+*/
+std::optional<error_t> Start_Continuous(uint32_t period_ms);
+std::optional<error_t> Stop_Continuous();
+/**
+ * Fetch the latest result if one is ready, ready is set false otherwise.
+ * Never waits on the sensor.
+*/
+std::optional<error_t> Try_Read_Range(uint16_t& distance, bool& ready);
+
+/**
+ * Queue the range read and the interrupt clear of Read_Range_Result on the
+ * async I2C engine and return without waiting. on_complete runs in interrupt
+ * context once both have finished, the result is then collected with
+ * Get_Range. Returns HAL_BUSY while an earlier read has not been collected.
+*/
+HAL_StatusTypeDef Submit_Read_Range(mbed::Callback<void()> on_complete);
+std::optional<error_t> Get_Range(uint16_t& distance);
+
+/**
+ * I2C transactions used by the last Perform_Single_Shot_Read, Read_Range_Result
+ * or Try_Read_Range call.
+*/
+uint32_t Get_Last_Read_Transaction_Count();
 
 std::optional<error_t> data_init(const VL53L0X_Config_t& config);
 std::optional<error_t> static_init(const VL53L0X_Config_t& config);
@@ -174,6 +211,8 @@ std::optional<error_t> get_enabled_sequence_steps(enabled_steps_t& steps);
 std::optional<error_t> get_sequence_steps_timeouts(enabled_steps_t& steps, timeouts_t& timeouts);
 std::optional<error_t> get_vcsel_pulse_period(uint8_t& pulse_period, VcselPulsePeriod period);
 std::optional<error_t> perform_single_ref_calibration(uint8_t vhv_init_byte);
+std::optional<error_t> load_stop_variable();
+void prepare_stop_variable_sequence();
 
 uint32_t convert_timeout_clocks_to_microseconds(uint16_t period_mclks, uint16_t period_pclks);
 uint16_t convert_timeout_us_to_mclks(uint32_t timeout_us, u_int16_t period_pclks);
@@ -1,4 +1,5 @@
 #pragma once
+#include <memory>
 #include <vector>
 
 #include "http_client/http_client.h"
@@ -6,6 +7,14 @@
 #include "mbed.h"
 
 namespace SimpleSlam {
+
+enum class PayloadFormat {
+    // Human readable, printed before sending
+    JSON,
+    // Packed point batch, see data/point_batch.h
+    BINARY,
+};
+
 class BufferedHTTPClient {
    private:
     typedef struct point_data {
@@ -18,11 +27,19 @@ class BufferedHTTPClient {
     Mutex _mutex;
     ConditionVariable _cond_var;
     std::string _host;
+    PayloadFormat _format;
     std::vector<point_data_t> _buffered_data;
+    // Serialized /api/collect body, sized once for a full buffer
+    size_t _payload_capacity;
+    std::unique_ptr<char[]> _payload;
+
+    size_t serialize_json();
+    size_t serialize_binary();
 
    public:
     BufferedHTTPClient(SimpleSlam::HttpClient& http_client, size_t capacity,
-                       std::string host);
+                       std::string host,
+                       PayloadFormat format = PayloadFormat::BINARY);
     void begin_processing();
     void add_data(point_data_t const& data);
 };
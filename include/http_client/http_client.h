@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include "WiFiInterface.h"
 #include "data/json.h"
 #include "mbed.h"
@@ -7,6 +9,13 @@
 #define RESPONSE_SIZE 1024
 namespace SimpleSlam {
 
+/**
+ * Minimal HTTP/1.1 client over one TCP socket. By default every request
+ * opens and closes its own connection. With keep-alive on, the socket stays
+ * open between requests and responses are read up to their Content-Length
+ * so the next request can follow on the same connection.
+ */
+
 class HttpClient {
    public:
     enum class ErrorCode {
@@ -17,10 +26,38 @@ class HttpClient {
     };
 
    private:
+    typedef struct response {
+        int status;
+        // The server will take another request on this connection
+        bool keep_alive;
+    } response_t;
+
+    typedef struct dns_entry {
+        std::string host;
+        SocketAddress address;
+        Kernel::Clock::time_point expires;
+    } dns_entry_t;
+
+    // Blocking socket calls give up after this long
+    static constexpr int _SOCKET_TIMEOUT_MS = 5000;
+    // The ISM43362 does not report record TTLs, so cache for a fixed time
+    static constexpr std::chrono::minutes _DNS_TTL{5};
+    static constexpr size_t _DNS_CACHE_SIZE = 4;
+
     TCPSocket _socket;
     std::unique_ptr<WiFiInterface> _wifi;
     SocketAddress _addr;
     int _port;
+    bool _keep_alive;
+    std::chrono::milliseconds _idle_timeout;
+    bool _connected;
+    std::string _connected_host;
+    Kernel::Clock::time_point _last_used;
+    // Response headers, and the body while it is drained
+    std::unique_ptr<char[]> _response;
+    std::array<dns_entry_t, _DNS_CACHE_SIZE> _dns_cache;
+    uint32_t _dns_hits;
+    uint32_t _dns_misses;
 
    public:
     typedef std::pair<ErrorCode, std::string> error_t;
@@ -30,15 +67,48 @@ class HttpClient {
 
     std::optional<error_t> init();
 
+    /**
+     * Reuse one connection across requests with Connection: keep-alive.
+     * A connection left idle for longer than idle_timeout is closed before
+     * the next request, in case the server or access point dropped it. A
+     * reused connection found closed before the server answered is reopened
+     * and the request sent once more, timeouts are never retried.
+     */
+    void set_keep_alive(bool keep_alive,
+                        std::chrono::milliseconds idle_timeout =
+                            std::chrono::seconds(30));
+
     std::optional<error_t> post_request(std::string host, std::string endpoint,
                                         JSON body_json);
 
+    /**
+     * POST a body that is already serialized, e.g. by JSONWriter.
+     */
+    std::optional<error_t> post_request(std::string host, std::string endpoint,
+                                        const char* body, size_t body_length,
+                                        const char* content_type = "application/json");
+
     std::optional<error_t> get_request(std::string host, std::string endpoint);
 
     std::optional<error_t> delete_request(std::string host,
                                           std::string endpoint);
 
+    /** Lookups answered without gethostbyname, IP literals included */
+    uint32_t dns_cache_hits() const;
+    /** Lookups that went out to the WiFi module */
+    uint32_t dns_cache_misses() const;
+
    private:
+    std::optional<error_t> send_request(const std::string& host,
+                                        const std::string& request,
+                                        ErrorCode error);
+    bool connect(const std::string& host, bool& reused);
+    bool resolve(const std::string& host, SocketAddress* address);
+    void forget(const std::string& host);
+    void disconnect();
+    bool send_all(const char* data, size_t length, bool& closed_by_peer);
+    std::optional<response_t> read_response(bool& closed_by_peer);
+
     std::string error_message(ErrorCode error);
 };
 
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <vector>
 #include "math/vector.h"
 #include "stdint.h"
 
@@ -8,13 +7,13 @@ namespace SimpleSlam::Math {
 
 inline constexpr double pi = 3.141592653589793238462643383279;
 
+/**
+ * Corrected reading = soft_iron * (reading - offset). Produced by
+ * MagnetometerCalibrator.
+ */
 typedef struct magnetometer_calibration {
-    double offset_x;
-    double offset_y;
-    double offset_z;
-    double scale_x;
-    double scale_y;
-    double scale_z;
+    double offset[3];        // Hard iron, mgauss
+    double soft_iron[3][3];  // Row major
 } magnetometer_calibration_t;
 
 Vector2 Convert_Tof_Direction_Vector(
@@ -28,6 +27,4 @@ Vector2 Convert_To_Spatial_Point(Vector2 const& tof_direction_vector,
 
 Vector3 Adjust_Magnetometer_Vector(Vector3 const& magnetometer_vector, magnetometer_calibration_t const& calibration_data);
 
-magnetometer_calibration_t Fill_Magnetometer_Calibration_Data(std::vector<Vector3> const& readings);
-
 }  // namespace SimpleSlam::Math
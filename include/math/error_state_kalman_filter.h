@@ -0,0 +1,108 @@
+#pragma once
+
+#include "math/matrix.h"
+#include "math/quaternion.h"
+#include "math/vector.h"
+
+namespace SimpleSlam::Math {
+
+/**
+ * Noise densities and measurement noise for the error-state filter. Rates
+ * are in rad/s, accelerations in m/s^2.
+ */
+typedef struct eskf_config {
+    float gyro_noise;               // rad/s/sqrt(Hz)
+    float accel_noise;              // m/s^2/sqrt(Hz)
+    float gyro_bias_walk;           // rad/s^2/sqrt(Hz)
+    float accel_bias_walk;          // m/s^3/sqrt(Hz)
+    float zero_velocity_noise;      // m/s, ZUPT
+    float zero_rate_noise;          // rad/s, gyro reading while stationary
+    float heading_noise;            // rad, magnetometer heading
+    float initial_attitude_sigma;   // rad
+    float initial_gyro_bias_sigma;  // rad/s
+    float initial_accel_bias_sigma; // m/s^2
+} eskf_config_t;
+
+inline constexpr eskf_config_t ESKF_DEFAULT_CONFIG = {
+    .gyro_noise = 1e-3f,
+    .accel_noise = 2e-2f,
+    .gyro_bias_walk = 1e-5f,
+    .accel_bias_walk = 1e-4f,
+    .zero_velocity_noise = 0.02f,
+    .zero_rate_noise = 5e-3f,
+    .heading_noise = 0.1f,
+    .initial_attitude_sigma = 0.1f,
+    .initial_gyro_bias_sigma = 0.01f,
+    .initial_accel_bias_sigma = 0.2f,
+};
+
+/**
+ * 15-state error-state Kalman filter for strapdown navigation.
+ *
+ * The nominal state (orientation, velocity, position, gyro bias, accel bias)
+ * is integrated directly from the IMU. The filter tracks the covariance of
+ * the error in that state, [attitude, velocity, position, gyro bias,
+ * accel bias], with the attitude error taken in the world frame. Measurement
+ * updates estimate the error, fold it into the nominal state and reset it.
+ *
+ * World frame matches the INS, x is magnetic north and z is up.
+ */
+class ErrorStateKalmanFilter {
+   public:
+    static const size_t STATE_SIZE = 15;
+    typedef Matrix<STATE_SIZE, STATE_SIZE> covariance_t;
+
+    ErrorStateKalmanFilter(const Quaternion& orientation, const Vector3& velocity,
+                           const Vector3& position, const Vector3& gyro_bias,
+                           const Vector3& accel_bias,
+                           const eskf_config_t& config = ESKF_DEFAULT_CONFIG);
+
+    /**
+     * Propagate the nominal state and covariance by one IMU sample.
+     * @param angular_velocity Raw body rates in rad/s
+     * @param force Raw specific force in m/s^2
+     */
+    void predict(const Vector3& angular_velocity, const Vector3& force,
+                 double time_delta);
+
+    /**
+     * Zero velocity and zero angular rate update, for samples flagged as
+     * stationary. The gyro reading is then a direct measurement of its bias.
+     */
+    void update_stationary(const Vector3& angular_velocity);
+
+    /**
+     * Heading update from a magnetometer reading in the body frame.
+     */
+    void update_heading(const Vector3& magno);
+
+    Quaternion get_orientation() const;
+    Vector3 get_velocity() const;
+    Vector3 get_position() const;
+    Vector3 get_gyro_bias() const;
+    Vector3 get_accel_bias() const;
+    const covariance_t& get_covariance() const;
+
+   private:
+    template <size_t M>
+    void update(const Matrix<M, STATE_SIZE>& h, const Matrix<M, 1>& innovation,
+                const Matrix<M, M>& noise);
+    void inject(const Matrix<STATE_SIZE, 1>& error);
+
+    static const size_t _ATTITUDE = 0;
+    static const size_t _VELOCITY = 3;
+    static const size_t _POSITION = 6;
+    static const size_t _GYRO_BIAS = 9;
+    static const size_t _ACCEL_BIAS = 12;
+    static constexpr double _GRAVITY = 9.8;
+
+    const eskf_config_t _config;
+    Quaternion _orientation;
+    Vector3 _velocity;
+    Vector3 _position;
+    Vector3 _gyro_bias;
+    Vector3 _accel_bias;
+    covariance_t _covariance;
+};
+
+}  // namespace SimpleSlam::Math
@@ -0,0 +1,197 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <cmath>
+
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+#include "cmsis_compiler.h"
+#endif
+
+#include "math/quaternion.h"
+#include "math/vector.h"
+
+namespace SimpleSlam::Math {
+
+/**
+ * Signed 32-bit fixed-point number with FRAC fractional bits. Arithmetic
+ * saturates instead of wrapping, so an overflowing fusion step clips rather
+ * than flipping sign. Drops into BasicVector3 and BasicQuaternion so the
+ * fusion code can run without the FPU.
+ *
+ * Add and subtract use the DSP extension's QADD/QSUB where available.
+ * Multiply and divide go through a 64-bit intermediate.
+ */
+template <int FRAC>
+class FixedPoint {
+    static_assert(FRAC > 0 && FRAC < 32, "Need at least the sign bit");
+
+   public:
+    static constexpr int FRACTIONAL_BITS = FRAC;
+
+    constexpr FixedPoint() : _raw{0} {}
+    constexpr FixedPoint(int value)
+        : _raw{saturate((int64_t)value * ONE)} {}
+    constexpr FixedPoint(double value)
+        : _raw{saturate_double(value * ONE)} {}
+
+    template <int OTHER_FRAC>
+    constexpr explicit FixedPoint(FixedPoint<OTHER_FRAC> other)
+        : _raw{rescale<OTHER_FRAC>(other.raw())} {}
+
+    static constexpr FixedPoint from_raw(int32_t raw) {
+        FixedPoint result;
+        result._raw = raw;
+        return result;
+    }
+
+    /**
+     * numerator / denominator without going through floating point, for
+     * raw sensor counts, e.g. from_ratio(accel_mg, 1000) for g.
+     */
+    static constexpr FixedPoint from_ratio(int32_t numerator, int32_t denominator) {
+        return from_raw(divide((int64_t)numerator * ONE, denominator));
+    }
+
+    constexpr int32_t raw() const { return _raw; }
+
+    constexpr explicit operator double() const { return (double)_raw / ONE; }
+    constexpr explicit operator float() const { return (float)_raw / ONE; }
+
+    friend FixedPoint operator+(FixedPoint a, FixedPoint b) {
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+        return from_raw(__QADD(a._raw, b._raw));
+#else
+        return from_raw(saturate((int64_t)a._raw + b._raw));
+#endif
+    }
+
+    friend FixedPoint operator-(FixedPoint a, FixedPoint b) {
+#if defined(__ARM_FEATURE_DSP) && __ARM_FEATURE_DSP
+        return from_raw(__QSUB(a._raw, b._raw));
+#else
+        return from_raw(saturate((int64_t)a._raw - b._raw));
+#endif
+    }
+
+    friend FixedPoint operator*(FixedPoint a, FixedPoint b) {
+        return from_raw(saturate(round_shift((int64_t)a._raw * b._raw, FRAC)));
+    }
+
+    friend FixedPoint operator/(FixedPoint a, FixedPoint b) {
+        return from_raw(divide((int64_t)a._raw * ONE, b._raw));
+    }
+
+    FixedPoint operator-() const { return from_raw(saturate(-(int64_t)_raw)); }
+
+    FixedPoint& operator+=(FixedPoint other) { return *this = *this + other; }
+    FixedPoint& operator-=(FixedPoint other) { return *this = *this - other; }
+    FixedPoint& operator*=(FixedPoint other) { return *this = *this * other; }
+    FixedPoint& operator/=(FixedPoint other) { return *this = *this / other; }
+
+    friend constexpr bool operator==(FixedPoint a, FixedPoint b) { return a._raw == b._raw; }
+    friend constexpr bool operator!=(FixedPoint a, FixedPoint b) { return a._raw != b._raw; }
+    friend constexpr bool operator<(FixedPoint a, FixedPoint b) { return a._raw < b._raw; }
+    friend constexpr bool operator>(FixedPoint a, FixedPoint b) { return a._raw > b._raw; }
+    friend constexpr bool operator<=(FixedPoint a, FixedPoint b) { return a._raw <= b._raw; }
+    friend constexpr bool operator>=(FixedPoint a, FixedPoint b) { return a._raw >= b._raw; }
+
+    friend FixedPoint fabs(FixedPoint a) { return a._raw < 0 ? -a : a; }
+
+    /** Bit-by-bit integer square root, negative inputs give zero */
+    friend FixedPoint sqrt(FixedPoint a) {
+        if (a._raw <= 0) {
+            return FixedPoint();
+        }
+        uint64_t remainder = (uint64_t)a._raw << FRAC;
+        uint64_t root = 0;
+        uint64_t bit = (uint64_t)1 << 62;
+        while (bit > remainder) {
+            bit >>= 2;
+        }
+        while (bit != 0) {
+            if (remainder >= root + bit) {
+                remainder -= root + bit;
+                root = (root >> 1) + bit;
+            } else {
+                root >>= 1;
+            }
+            bit >>= 2;
+        }
+        return from_raw(saturate((int64_t)root));
+    }
+
+    // Trig goes through float. Only axis-angle setup and euler() use it,
+    // neither is on the per-sample path.
+    friend FixedPoint sin(FixedPoint a) { return FixedPoint(std::sin((double)a)); }
+    friend FixedPoint cos(FixedPoint a) { return FixedPoint(std::cos((double)a)); }
+    friend FixedPoint asin(FixedPoint a) { return FixedPoint(std::asin((double)a)); }
+    friend FixedPoint atan2(FixedPoint y, FixedPoint x) {
+        return FixedPoint(std::atan2((double)y, (double)x));
+    }
+
+   private:
+    static constexpr int64_t ONE = (int64_t)1 << FRAC;
+
+    static constexpr int32_t saturate(int64_t value) {
+        return value > INT32_MAX ? INT32_MAX
+               : value < INT32_MIN ? INT32_MIN
+                                   : (int32_t)value;
+    }
+
+    static constexpr int32_t saturate_double(double value) {
+        return value >= (double)INT32_MAX ? INT32_MAX
+               : value <= (double)INT32_MIN
+                   ? INT32_MIN
+                   : (int32_t)(value < 0 ? value - 0.5 : value + 0.5);
+    }
+
+    /** Arithmetic right shift, rounding to nearest */
+    static constexpr int64_t round_shift(int64_t value, int shift) {
+        return (value + ((int64_t)1 << (shift - 1))) >> shift;
+    }
+
+    template <int OTHER_FRAC>
+    static constexpr int32_t rescale(int32_t raw) {
+        if constexpr (OTHER_FRAC > FRAC) {
+            return saturate(round_shift(raw, OTHER_FRAC - FRAC));
+        } else {
+            return saturate((int64_t)raw * ((int64_t)1 << (FRAC - OTHER_FRAC)));
+        }
+    }
+
+    /** Division by zero saturates towards the sign of the numerator */
+    static constexpr int32_t divide(int64_t numerator, int64_t denominator) {
+        if (denominator == 0) {
+            return numerator < 0 ? INT32_MIN : INT32_MAX;
+        }
+        return saturate(numerator / denominator);
+    }
+
+    int32_t _raw;
+};
+
+// Sensor-scale values, +-32768 with 1.5e-5 resolution
+typedef FixedPoint<16> q16_16_t;
+// CMSIS q31_t layout, for coefficients and gains in [-1, 1)
+typedef FixedPoint<31> q1_31_t;
+// Attitude. Unit quaternions need w == 1 exactly and a little headroom
+// above it for normalize(), which Q1.31 cannot hold. Angles past 2 rad do
+// not fit, convert to Quaternionf before calling euler().
+typedef FixedPoint<30> q2_30_t;
+
+typedef BasicVector3<q16_16_t> Vector3q;
+typedef BasicVector3<q2_30_t> UnitVector3q;
+typedef BasicQuaternion<q2_30_t> Quaternionq;
+
+/**
+ * Raw int16 sensor buffer straight to Q16.16, scaled by 1 / divisor.
+ * LSM6DSL accel in mg with divisor 1000 gives g.
+ */
+inline Vector3q To_Fixed_Vector(const int16_t raw[3], int32_t divisor) {
+    return Vector3q(q16_16_t::from_ratio(raw[0], divisor),
+                    q16_16_t::from_ratio(raw[1], divisor),
+                    q16_16_t::from_ratio(raw[2], divisor));
+}
+
+}  // namespace SimpleSlam::Math
@@ -1,35 +1,147 @@
 #pragma once
 
-#include <deque>
+#include <stdint.h>
 
+#include <memory>
+
+#include "math/error_state_kalman_filter.h"
+#include "math/orientation_filter.h"
 #include "math/quaternion.h"
+#include "math/rolling_variance.h"
+#include "math/sample_block.h"
 #include "math/vector.h"
 
 namespace SimpleSlam::Math {
 
+enum class NavigationMode {
+    // Orientation filter plus direct integration, velocity zeroed on ZUPT
+    STRAPDOWN,
+    // 15-state error-state Kalman filter, ZUPT and heading as measurements.
+    // It replaces the orientation filter, the integrator and the offset
+    // refinement with its own propagation and bias states.
+    ERROR_STATE_KALMAN,
+};
+
+/**
+ * How strapdown mode integrates world acceleration into velocity and
+ * position. Trapezoidal and RK4 treat acceleration as varying linearly
+ * between samples instead of holding it for the whole step.
+ */
+enum class Integrator {
+    EULER,
+    TRAPEZOIDAL,
+    RK4,
+};
+
 class InertialNavigationSystem {
    public:
     InertialNavigationSystem(const double time_delta, const Vector3& e_north,
                              const Vector3& accel_offset,
                              const Vector3& gyro_offset,
-                             const Vector3& velocity, const Vector3& position);
+                             const Vector3& velocity, const Vector3& position,
+                             std::unique_ptr<OrientationFilter> orientation_filter =
+                                 std::make_unique<ComplementaryFilter>());
     Vector3 get_velocity() const;
     Vector3 get_position() const;
+    /** Rotation from the body frame into the world frame (x north, z up) */
+    Quaternion get_orientation() const;
+    /** Current gyro offset, refined while stationary */
+    Vector3 get_gyro_offset() const;
+    /** Current world frame accel offset (gravity included), refined while stationary */
+    Vector3 get_accel_offset() const;
     void update_position(const Vector3& angular_velocity, const Vector3& force,
                          const Vector3& magno);
+    /**
+     * Integrate over the time since the previous timestamped update, so a
+     * late tick covers the time it actually missed.
+     */
+    void update_position(const Vector3& angular_velocity, const Vector3& force,
+                         const Vector3& magno, uint32_t timestamp_us);
+    /**
+     * Integrate every sample drained from the IMU FIFO, oldest first, straight
+     * from the converted blocks. The magnetometer is sampled slower than the
+     * FIFO so one reading is shared across the batch.
+     * @param angular_velocity Body rates in rad/s
+     * @param force Specific force in g
+     * @param timestamps_us us_ticker time each sample was taken
+     */
+    template <size_t N>
+    void update_batch(const SampleBlock<N>& angular_velocity,
+                      const SampleBlock<N>& force,
+                      const uint32_t* timestamps_us, const Vector3& magno) {
+        const size_t count = angular_velocity.count < force.count
+                                 ? angular_velocity.count
+                                 : force.count;
+        for (size_t i = 0; i < count; i++) {
+            update_sample(Vector3(angular_velocity.x[i], angular_velocity.y[i],
+                                  angular_velocity.z[i]),
+                          Vector3(force.x[i], force.y[i], force.z[i]), magno,
+                          timestamps_us[i]);
+        }
+        update_heading(magno);
+    }
     void add_sample(const Vector3& sample);
     double calculate_variance() const;
+    /**
+     * Level the orientation from an averaged resting force and point it
+     * using the magnetometer, instead of assuming the board starts flat
+     * and facing north. The accel offset becomes that force in the world
+     * frame.
+     */
+    void align(const Vector3& force, const Vector3& magno);
+    /**
+     * Switch integration mode. The Kalman filter starts from the current
+     * state, so align first. Its gyro bias starts at the gyro offset and
+     * its accel bias at whatever the accel offset holds beyond gravity.
+     */
+    void set_navigation_mode(NavigationMode mode,
+                             const eskf_config_t& config = ESKF_DEFAULT_CONFIG);
+    void set_integrator(Integrator integrator);
 
    private:
-    static const int _NUM_SAMPLES = 8;
+    void update_sample(const Vector3& angular_velocity, const Vector3& force,
+                       const Vector3& magno, uint32_t timestamp_us);
+    void update_heading(const Vector3& magno);
+    double elapsed_time(uint32_t timestamp_us);
+    void integrate_motion(const Vector3& world_accel, double time_delta);
+    void refine_offsets(const Vector3& angular_velocity,
+                        const Vector3& world_force, double time_delta);
+    void integrate(const Vector3& angular_velocity, const Vector3& force,
+                   const Vector3& magno, double time_delta);
+    void integrate_error_state(const Vector3& angular_velocity,
+                               const Vector3& force, double time_delta);
+
+    // ZUPT looks at the variance of |accel|^2 over this long a window (s),
+    // the 8 samples at the old 25ms poll. Its length in samples follows the
+    // nominal time delta, e.g. 42 samples with the 208Hz FIFO.
+    static constexpr double _ZUPT_WINDOW = 0.2;
+    static const size_t _MAX_WINDOW_SAMPLES = 64;
+    // Variance of |accel|^2 in (m/s^2)^4. This is a per-sample spread, not
+    // a sum, and the accel runs at 6.66kHz behind the same LPF2 whatever
+    // the FIFO rate, so the threshold does not depend on the window length.
     static const int _VARIANCE_THRESHOLD = 300;
+    // Longest gap integrated in one step, anything longer is a stalled
+    // sensor and falls back to the nominal time delta.
+    static constexpr double _MAX_TIME_DELTA = 0.25;
+    // Offsets track stationary readings with this time constant (s)
+    static constexpr double _OFFSET_TIME_CONSTANT = 1.0;
+    // Above this rate (rad/s) the car is turning in place, not stationary
+    static constexpr double _MAX_STATIONARY_RATE = 0.05;
+    // Nominal step, used for untimed updates and the first timestamp
     const double _time_delta;
+    Integrator _integrator;
+    bool _has_timestamp;
+    uint32_t _last_timestamp_us;
+    Vector3 _last_world_accel;
+    size_t _stationary_samples;
     Vector3 _e_north;
     Quaternion _q;
+    std::unique_ptr<OrientationFilter> _orientation_filter;
+    std::unique_ptr<ErrorStateKalmanFilter> _error_state_filter;
     Vector3 _accel_offset;
     Vector3 _gyro_offset;
     Vector3 _velocity;
     Vector3 _position;
-    std::deque<Vector3> _samples;
+    RollingVariance<_MAX_WINDOW_SAMPLES> _samples;
 };
 }  // namespace SimpleSlam::Math
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "math/conversion.h"
+#include "math/matrix.h"
+#include "math/vector.h"
+
+namespace SimpleSlam::Math {
+
+/**
+ * Streaming magnetometer calibration. Readings are folded into the normal
+ * equations of a least-squares ellipsoid fit as they arrive, so memory is
+ * constant no matter how many are taken.
+ *
+ * The fitted ellipsoid gives the hard-iron offset (its centre) and a
+ * symmetric soft-iron matrix mapping it back onto a sphere of the same mean
+ * radius. If the fit is ill-conditioned, e.g. the board was only turned
+ * about one axis, solve() falls back to per-axis min/max.
+ */
+class MagnetometerCalibrator {
+   public:
+    MagnetometerCalibrator();
+    void add(const Vector3& reading);
+    size_t count() const;
+    void reset();
+    magnetometer_calibration_t solve() const;
+
+   private:
+    static const size_t _NUM_PARAMS = 9;
+    // Readings are mgauss, fitting in gauss keeps the fourth-order sums of
+    // the normal equations well scaled
+    static constexpr double _FIT_SCALE = 1000;
+    static const size_t _MIN_FIT_SAMPLES = 20;
+    // Every axis must span at least this fraction of the widest one. Turning
+    // about a single axis leaves the other axis range at the noise level,
+    // and the fit then invents that axis from noise.
+    static constexpr double _MIN_SPAN_RATIO = 0.5;
+    // Largest ratio between the quadric eigenvalues, i.e. the squared ratio
+    // of longest to shortest ellipsoid radius. Real soft-iron distortion is
+    // well under 2:1 in radius.
+    static constexpr double _MAX_EIGENVALUE_RATIO = 9;
+
+    bool fit_ellipsoid(magnetometer_calibration_t& calibration) const;
+    magnetometer_calibration_t fit_min_max() const;
+
+    // Upper triangle of D^T D and D^T 1 for rows
+    // [x^2, y^2, z^2, 2xy, 2xz, 2yz, 2x, 2y, 2z]
+    Matrix<_NUM_PARAMS, _NUM_PARAMS, double> _normal;
+    Matrix<_NUM_PARAMS, 1, double> _rhs;
+    size_t _count;
+    double _min[3];
+    double _max[3];
+};
+
+}  // namespace SimpleSlam::Math
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <stddef.h>
+
+#include <cmath>
+
+namespace SimpleSlam::Math {
+
+/**
+ * Fixed-size, row-major matrix. Storage lives inside the object, so these
+ * sit on the stack or inside their owner with no heap. Defaults to float,
+ * the Cortex-M4 FPU only does single precision.
+ */
+template <size_t R, size_t C, typename T = float>
+class Matrix {
+   public:
+    static constexpr size_t ROWS = R;
+    static constexpr size_t COLS = C;
+
+    constexpr Matrix() : _data{} {}
+
+    static constexpr Matrix zeros() { return Matrix(); }
+
+    static constexpr Matrix identity() {
+        static_assert(R == C, "Identity is only defined for square matrices");
+        Matrix result;
+        for (size_t i = 0; i < R; i++) {
+            result(i, i) = 1;
+        }
+        return result;
+    }
+
+    static constexpr Matrix diagonal(T value) {
+        return identity() * value;
+    }
+
+    constexpr T& operator()(size_t row, size_t col) { return _data[row * C + col]; }
+    constexpr const T& operator()(size_t row, size_t col) const { return _data[row * C + col]; }
+
+    constexpr Matrix operator+(const Matrix& other) const {
+        Matrix result;
+        for (size_t i = 0; i < R * C; i++) {
+            result._data[i] = _data[i] + other._data[i];
+        }
+        return result;
+    }
+
+    constexpr Matrix operator-(const Matrix& other) const {
+        Matrix result;
+        for (size_t i = 0; i < R * C; i++) {
+            result._data[i] = _data[i] - other._data[i];
+        }
+        return result;
+    }
+
+    constexpr Matrix operator*(T scalar) const {
+        Matrix result;
+        for (size_t i = 0; i < R * C; i++) {
+            result._data[i] = _data[i] * scalar;
+        }
+        return result;
+    }
+
+    template <size_t K>
+    constexpr Matrix<R, K, T> operator*(const Matrix<C, K, T>& other) const {
+        Matrix<R, K, T> result;
+        for (size_t i = 0; i < R; i++) {
+            for (size_t k = 0; k < C; k++) {
+                const T value = (*this)(i, k);
+                // Zero entries are common in the sparse Jacobians, skip them
+                if (value == 0) {
+                    continue;
+                }
+                for (size_t j = 0; j < K; j++) {
+                    result(i, j) += value * other(k, j);
+                }
+            }
+        }
+        return result;
+    }
+
+    constexpr Matrix<C, R, T> transpose() const {
+        Matrix<C, R, T> result;
+        for (size_t i = 0; i < R; i++) {
+            for (size_t j = 0; j < C; j++) {
+                result(j, i) = (*this)(i, j);
+            }
+        }
+        return result;
+    }
+
+    template <size_t BR, size_t BC>
+    constexpr Matrix<BR, BC, T> block(size_t row, size_t col) const {
+        Matrix<BR, BC, T> result;
+        for (size_t i = 0; i < BR; i++) {
+            for (size_t j = 0; j < BC; j++) {
+                result(i, j) = (*this)(row + i, col + j);
+            }
+        }
+        return result;
+    }
+
+    template <size_t BR, size_t BC>
+    constexpr void set_block(size_t row, size_t col, const Matrix<BR, BC, T>& value) {
+        for (size_t i = 0; i < BR; i++) {
+            for (size_t j = 0; j < BC; j++) {
+                (*this)(row + i, col + j) = value(i, j);
+            }
+        }
+    }
+
+    /** Average with the transpose to remove rounding asymmetry */
+    constexpr Matrix symmetrize() const {
+        static_assert(R == C, "Only square matrices can be symmetric");
+        return (*this + transpose()) * T(0.5);
+    }
+
+   private:
+    T _data[R * C];
+};
+
+/**
+ * Gauss-Jordan inversion with partial pivoting, meant for the small
+ * innovation covariances of a Kalman update.
+ * @return false if the matrix is singular, result is left unspecified.
+ */
+template <size_t N, typename T>
+bool Invert(const Matrix<N, N, T>& matrix, Matrix<N, N, T>& result) {
+    Matrix<N, N, T> work = matrix;
+    result = Matrix<N, N, T>::identity();
+
+    for (size_t col = 0; col < N; col++) {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < N; row++) {
+            if (std::fabs(work(row, col)) > std::fabs(work(pivot, col))) {
+                pivot = row;
+            }
+        }
+        if (work(pivot, col) == 0) {
+            return false;
+        }
+
+        if (pivot != col) {
+            for (size_t j = 0; j < N; j++) {
+                T tmp = work(col, j);
+                work(col, j) = work(pivot, j);
+                work(pivot, j) = tmp;
+                tmp = result(col, j);
+                result(col, j) = result(pivot, j);
+                result(pivot, j) = tmp;
+            }
+        }
+
+        const T inverse_pivot = 1 / work(col, col);
+        for (size_t j = 0; j < N; j++) {
+            work(col, j) *= inverse_pivot;
+            result(col, j) *= inverse_pivot;
+        }
+
+        for (size_t row = 0; row < N; row++) {
+            const T factor = work(row, col);
+            if (row == col || factor == 0) {
+                continue;
+            }
+            for (size_t j = 0; j < N; j++) {
+                work(row, j) -= factor * work(col, j);
+                result(row, j) -= factor * result(col, j);
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * Solve matrix * x = rhs in place by Gaussian elimination with partial
+ * pivoting. Cheaper on stack than Invert when only one solution is needed.
+ * @return false if the matrix is singular, rhs is left unspecified.
+ */
+template <size_t N, typename T>
+bool Solve(Matrix<N, N, T> matrix, Matrix<N, 1, T>& rhs) {
+    for (size_t col = 0; col < N; col++) {
+        size_t pivot = col;
+        for (size_t row = col + 1; row < N; row++) {
+            if (std::fabs(matrix(row, col)) > std::fabs(matrix(pivot, col))) {
+                pivot = row;
+            }
+        }
+        if (matrix(pivot, col) == 0) {
+            return false;
+        }
+
+        if (pivot != col) {
+            for (size_t j = col; j < N; j++) {
+                const T tmp = matrix(col, j);
+                matrix(col, j) = matrix(pivot, j);
+                matrix(pivot, j) = tmp;
+            }
+            const T tmp = rhs(col, 0);
+            rhs(col, 0) = rhs(pivot, 0);
+            rhs(pivot, 0) = tmp;
+        }
+
+        for (size_t row = col + 1; row < N; row++) {
+            const T factor = matrix(row, col) / matrix(col, col);
+            if (factor == 0) {
+                continue;
+            }
+            for (size_t j = col; j < N; j++) {
+                matrix(row, j) -= factor * matrix(col, j);
+            }
+            rhs(row, 0) -= factor * rhs(col, 0);
+        }
+    }
+
+    for (size_t i = N; i-- > 0;) {
+        T sum = rhs(i, 0);
+        for (size_t j = i + 1; j < N; j++) {
+            sum -= matrix(i, j) * rhs(j, 0);
+        }
+        rhs(i, 0) = sum / matrix(i, i);
+    }
+    return true;
+}
+
+}  // namespace SimpleSlam::Math
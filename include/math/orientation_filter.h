@@ -0,0 +1,144 @@
+#pragma once
+
+#include "math/quaternion.h"
+#include "math/vector.h"
+
+namespace SimpleSlam::Math {
+
+/**
+ * Integrate body rates over one step, q' = q + 0.5 q (w, 0) dt.
+ */
+template <typename T>
+BasicQuaternion<T> Integrate_Gyro(const BasicQuaternion<T>& q,
+                                  const BasicVector3<T>& angular_velocity,
+                                  T time_delta) {
+    const BasicQuaternion<T> q_dot =
+        q * BasicQuaternion<T>(angular_velocity * T(0.5), T(0));
+    return (q + q_dot * time_delta).normalize();
+}
+
+/**
+ * Rotation taking unit vector from onto unit vector to, scaled down to
+ * gain of the full angle by nlerp against the identity. Built from the half
+ * way quaternion (from x to, 1 + from . to), so there is no trig.
+ */
+template <typename T>
+BasicQuaternion<T> Partial_Rotation(const BasicVector3<T>& from,
+                                    const BasicVector3<T>& to, T gain) {
+    const BasicQuaternion<T> full(from.cross(to), T(1) + from.dot(to));
+    // Vectors are opposite, the axis is undefined. Let the next sample
+    // move us off the singularity.
+    if (full.norm_squared() < T(1e-12)) {
+        return BasicQuaternion<T>();
+    }
+    const BasicQuaternion<T> target = full.normalize();
+    return (BasicQuaternion<T>() * (T(1) - gain) + target * gain).normalize();
+}
+
+/**
+ * One complementary filter step. Templated so the same arithmetic can be
+ * timed in float and double, ComplementaryFilter runs it in double.
+ */
+template <typename T>
+BasicQuaternion<T> Complementary_Update(const BasicQuaternion<T>& orientation,
+                                        const BasicVector3<T>& angular_velocity,
+                                        const BasicVector3<T>& force,
+                                        const BasicVector3<T>& magno,
+                                        T time_delta, T gain) {
+    // Gyro Integration
+    BasicQuaternion<T> rot =
+        Integrate_Gyro(orientation, angular_velocity, time_delta);
+
+    // Tilt Correction, pull measured up towards world z
+    const BasicVector3<T> up = rot.rotate(force).normalize();
+    rot = (Partial_Rotation(up, BasicVector3<T>(0, 0, 1), gain) * rot)
+              .normalize();
+
+    // Yaw Correction w/ Magnetometer, pull horizontal field towards world x
+    const BasicVector3<T> magno_world = rot.rotate(magno);
+    const BasicVector3<T> heading(magno_world[0], magno_world[1], 0);
+    if (heading.dot(heading) == 0) {
+        return rot;
+    }
+    return (Partial_Rotation(heading.normalize(), BasicVector3<T>(1, 0, 0),
+                             gain) *
+            rot)
+        .normalize();
+}
+
+/**
+ * Strategy for fusing one IMU/magnetometer sample into the orientation.
+ * Orientations rotate the body frame into the world frame, world x is
+ * magnetic north (horizontal) and world z is up.
+ */
+class OrientationFilter {
+   public:
+    virtual ~OrientationFilter() = default;
+
+    /**
+     * @param orientation Current orientation
+     * @param angular_velocity Body rates in rad/s
+     * @param force Specific force in the body frame (any scale)
+     * @param magno Magnetometer in the body frame (any scale)
+     * @param time_delta Seconds since the previous sample
+     * @return The updated, normalized orientation
+     */
+    virtual Quaternion update(const Quaternion& orientation,
+                              const Vector3& angular_velocity,
+                              const Vector3& force, const Vector3& magno,
+                              double time_delta) = 0;
+};
+
+/**
+ * Gyro integration followed by a fixed fraction of the tilt and heading
+ * error, the original INS correction. Corrections are applied with nlerp so
+ * no trig is needed.
+ */
+class ComplementaryFilter : public OrientationFilter {
+   public:
+    ComplementaryFilter(double gain = 0.05);
+    Quaternion update(const Quaternion& orientation,
+                      const Vector3& angular_velocity, const Vector3& force,
+                      const Vector3& magno, double time_delta) override;
+
+   private:
+    const double _gain;
+};
+
+/**
+ * Madgwick gradient-descent MARG filter, beta trades gyro trust against
+ * convergence speed.
+ * Reference: S. Madgwick, "An efficient orientation filter for inertial and
+ * inertial/magnetic sensor arrays", 2010.
+ */
+class MadgwickFilter : public OrientationFilter {
+   public:
+    MadgwickFilter(double beta = 0.1);
+    Quaternion update(const Quaternion& orientation,
+                      const Vector3& angular_velocity, const Vector3& force,
+                      const Vector3& magno, double time_delta) override;
+
+   private:
+    const double _beta;
+};
+
+/**
+ * Mahony explicit complementary filter, a PI controller on the error
+ * between measured and predicted gravity and magnetic field directions.
+ * Reference: R. Mahony et al., "Nonlinear Complementary Filters on the
+ * Special Orthogonal Group", 2008.
+ */
+class MahonyFilter : public OrientationFilter {
+   public:
+    MahonyFilter(double kp = 1.0, double ki = 0.0);
+    Quaternion update(const Quaternion& orientation,
+                      const Vector3& angular_velocity, const Vector3& force,
+                      const Vector3& magno, double time_delta) override;
+
+   private:
+    const double _kp;
+    const double _ki;
+    Vector3 _integral_error{0, 0, 0};
+};
+
+}  // namespace SimpleSlam::Math
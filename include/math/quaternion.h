@@ -1,40 +1,263 @@
 /**
- * Disclaimer: The code written in this file has been heavily inspired from https://cs.stanford.edu/~acoates/quaternion.h. 
+ * Disclaimer: The code written in this file has been heavily inspired from https://cs.stanford.edu/~acoates/quaternion.h.
  * Certain adjustments were made to make it cohesive with our Vector3 implementation.
 */
 
 #pragma once
 
-#include "vector.h"
+#include <cmath>
+
+#include "math/conversion.h"
+#include "math/vector.h"
 
 namespace SimpleSlam::Math {
-class Quaternion {
+
+/**
+ * Header-only so products and rotations inline into the fusion code.
+ * Stored as [x, y, z, w]. Math functions are looked up by argument so a
+ * FixedPoint T uses its own overloads.
+ */
+template <typename T>
+class BasicQuaternion {
    private:
-    double _data[4];
+    T _data[4];
+
+    /**
+     * Below this distance from unit norm, 1 / sqrt(n) is replaced by the
+     * first Newton step (3 - n) / 2. The error is ~3/8 of the distance squared.
+     */
+    static constexpr T _FAST_NORMALIZE_LIMIT = T(1e-3);
 
    public:
-    static Quaternion axis_angle_to_quat(const double& theta, const Vector3& v);
-    Quaternion();
-    Quaternion(const Vector3& v, double w);
-    Quaternion(double x, double y, double z, double w);
-    double x() const;
-    double y() const;
-    double z() const;
-    double w() const;
-    Vector3 complex() const;
-    void complex(const Vector3& c);
-    double real() const;
-    void real(double r);
-    Quaternion conjugate(void) const;
-    Quaternion inverse(void) const;
-    Quaternion product(const Quaternion& rhs) const;
-    Quaternion operator*(const Quaternion& rhs) const;
-    Quaternion operator*(double s) const;
-    Quaternion operator+(const Quaternion& rhs) const;
-    Quaternion operator-(const Quaternion& rhs) const;
-    Quaternion operator-() const;
-    Quaternion operator/(double s) const;
-    double norm() const;
-    Vector3 euler(void) const;
+    /**
+     * @brief Computes the axis-angle representation of the quaternion.
+     *
+     * @return The quaternion formulated by the angle and axis of rotation.
+    */
+    static BasicQuaternion axis_angle_to_quat(const T& theta, const BasicVector3<T>& v) {
+        using std::cos;
+        using std::sin;
+        const T s = sin(theta / 2);
+        return BasicQuaternion(v[0] * s, v[1] * s, v[2] * s, cos(theta / 2));
+    }
+
+    constexpr BasicQuaternion() : _data{0, 0, 0, 1} {}
+    constexpr BasicQuaternion(const BasicVector3<T>& v, T w) : _data{v[0], v[1], v[2], w} {}
+    constexpr BasicQuaternion(T x, T y, T z, T w) : _data{x, y, z, w} {}
+
+    template <typename U>
+    constexpr explicit BasicQuaternion(const BasicQuaternion<U>& other)
+        : _data{static_cast<T>(other.x()), static_cast<T>(other.y()),
+                static_cast<T>(other.z()), static_cast<T>(other.w())} {}
+
+    constexpr T x() const { return _data[0]; }
+    constexpr T y() const { return _data[1]; }
+    constexpr T z() const { return _data[2]; }
+    constexpr T w() const { return _data[3]; }
+
+    constexpr BasicVector3<T> complex() const { return BasicVector3<T>(_data[0], _data[1], _data[2]); }
+    constexpr void complex(const BasicVector3<T>& c) {
+        _data[0] = c[0];
+        _data[1] = c[1];
+        _data[2] = c[2];
+    }
+
+    /**
+     * @brief Retrieve the scalar part of the quaternion.
+     *
+     * @return The scalar part of the quaternion.
+     */
+    constexpr T real() const { return _data[3]; }
+    constexpr void real(T r) { _data[3] = r; }
+
+    constexpr BasicQuaternion conjugate(void) const {
+        return BasicQuaternion(-_data[0], -_data[1], -_data[2], _data[3]);
+    }
+
+    /**
+     * @brief Computes the inverse of this quaternion.
+     *
+     * @note This is a general inverse.  If you know a priori
+     * that you're using a unit quaternion (i.e., norm() == 1),
+     * it will be significantly faster to use conjugate() instead.
+     *
+     * @return The quaternion q such that q * (*this) == (*this) * q
+     * == [ 0 0 0 1 ]<sup>T</sup>.
+     */
+    constexpr BasicQuaternion inverse(void) const { return conjugate() / norm_squared(); }
+
+    /**
+     * @brief Computes the product of this quaternion with the
+     * quaternion 'rhs'.
+     *
+     * @param rhs The right-hand-side of the product operation.
+     *
+     * @return The quaternion product (*this) x @p rhs.
+     */
+    constexpr BasicQuaternion product(const BasicQuaternion& rhs) const {
+        return BasicQuaternion(
+            y() * rhs.z() - z() * rhs.y() + x() * rhs.w() + w() * rhs.x(),
+            z() * rhs.x() - x() * rhs.z() + y() * rhs.w() + w() * rhs.y(),
+            x() * rhs.y() - y() * rhs.x() + z() * rhs.w() + w() * rhs.z(),
+            w() * rhs.w() - x() * rhs.x() - y() * rhs.y() - z() * rhs.z());
+    }
+
+    /**
+     * @brief Rotate a vector by this unit quaternion, equivalent to
+     * (*this) * [v, 0] * conjugate() without the two full products.
+     *
+     * t = 2 (u x v), v' = v + w t + u x t, 15 multiplies.
+     */
+    constexpr BasicVector3<T> rotate(const BasicVector3<T>& v) const {
+        const BasicVector3<T> u = complex();
+        BasicVector3<T> t = u.cross(v);
+        t = t + t;
+        return v + t * w() + u.cross(t);
+    }
+
+    /**
+     * @brief Rotate a vector by the inverse of this unit quaternion,
+     * equivalent to conjugate().rotate(v).
+     */
+    constexpr BasicVector3<T> rotate_inverse(const BasicVector3<T>& v) const {
+        const BasicVector3<T> u = complex();
+        BasicVector3<T> t = v.cross(u);
+        t = t + t;
+        return v + t * w() + t.cross(u);
+    }
+
+    /**
+     * @brief Quaternion product operator.
+     *
+     * The result is a quaternion such that:
+     *
+     * result.real() = (*this).real() * rhs.real() -
+     * (*this).complex().dot(rhs.complex());
+     *
+     * and:
+     *
+     * result.complex() = rhs.complex() * (*this).real
+     * + (*this).complex() * rhs.real()
+     * - (*this).complex().cross(rhs.complex());
+     *
+     * @return The quaternion product (*this) x rhs.
+     */
+    constexpr BasicQuaternion operator*(const BasicQuaternion& rhs) const { return product(rhs); }
+
+    /**
+     * @brief Quaternion scalar product operator.
+     * @param s A scalar by which to multiply all components
+     * of this quaternion.
+     * @return The quaternion (*this) * s.
+     */
+    constexpr BasicQuaternion operator*(T s) const {
+        return BasicQuaternion(x() * s, y() * s, z() * s, w() * s);
+    }
+
+    /**
+     * @brief Produces the sum of this quaternion and rhs.
+     */
+    constexpr BasicQuaternion operator+(const BasicQuaternion& rhs) const {
+        return BasicQuaternion(x() + rhs.x(), y() + rhs.y(), z() + rhs.z(), w() + rhs.w());
+    }
+
+    /**
+     * @brief Produces the difference of this quaternion and rhs.
+     */
+    constexpr BasicQuaternion operator-(const BasicQuaternion& rhs) const {
+        return BasicQuaternion(x() - rhs.x(), y() - rhs.y(), z() - rhs.z(), w() - rhs.w());
+    }
+
+    /**
+     * @brief Unary negation.
+     */
+    constexpr BasicQuaternion operator-() const { return BasicQuaternion(-x(), -y(), -z(), -w()); }
+
+    /**
+     * @brief Quaternion scalar division operator.
+     * @param s A scalar by which to divide all components
+     * of this quaternion.
+     * @return The quaternion (*this) / s.
+     */
+    constexpr BasicQuaternion operator/(T s) const {
+        return BasicQuaternion(x() / s, y() / s, z() / s, w() / s);
+    }
+
+    constexpr T norm_squared() const {
+        return _data[0] * _data[0] + _data[1] * _data[1] +
+               _data[2] * _data[2] + _data[3] * _data[3];
+    }
+
+    /**
+     * @brief Returns the norm ("magnitude") of the quaternion.
+     * @return The 2-norm of [ w(), x(), y(), z() ]<sup>T</sup>.
+     */
+    T norm() const {
+        using std::sqrt;
+        return sqrt(norm_squared());
+    }
+
+    /**
+     * @brief Scale back to unit norm. Quaternions that have only drifted
+     * slightly, the common case after a product of unit quaternions, skip
+     * the sqrt and divide. The step is written as 1.5 - n / 2 so it stays
+     * inside the range of a Q2.30 T.
+     */
+    BasicQuaternion normalize() const {
+        using std::fabs;
+        using std::sqrt;
+        const T n = norm_squared();
+        if (fabs(1 - n) < _FAST_NORMALIZE_LIMIT) {
+            return *this * (T(1.5) - n / 2);
+        }
+        return *this * (1 / sqrt(n));
+    }
+
+    /** @brief Returns an equivalent euler angle representation of
+     * this quaternion.
+     * @return Euler angles in roll-pitch-yaw order.
+     */
+    BasicVector3<T> euler(void) const {
+        using std::asin;
+        using std::atan2;
+        using std::fabs;
+        const T PI_OVER_2 = T(pi * 0.5);
+        const T EPSILON = T(1e-10);
+
+        // quick conversion to Euler angles to give tilt to user
+        const T sqw = _data[3] * _data[3];
+        const T sqx = _data[0] * _data[0];
+        const T sqy = _data[1] * _data[1];
+        const T sqz = _data[2] * _data[2];
+
+        T roll = atan2(2 * (_data[3] * _data[0] + _data[1] * _data[2]),
+                       1 - 2 * (sqx + sqy));
+        T pitch = asin(2 * (_data[3] * _data[1] - _data[0] * _data[2]));
+        T yaw = atan2(2 * (_data[0] * _data[1] + _data[3] * _data[2]),
+                      1 - 2 * (sqy + sqz));
+
+        if (PI_OVER_2 - fabs(pitch) > EPSILON) {
+            yaw = atan2(2 * (_data[0] * _data[1] + _data[3] * _data[2]),
+                        sqx - sqy - sqz + sqw);
+            roll = atan2(2 * (_data[3] * _data[0] + _data[1] * _data[2]),
+                         sqw - sqx - sqy + sqz);
+        } else {
+            // compute heading from local 'down' vector
+            yaw = atan2(2 * _data[1] * _data[2] - 2 * _data[0] * _data[3],
+                        2 * _data[0] * _data[2] + 2 * _data[1] * _data[3]);
+            roll = 0;
+
+            // If facing down, reverse yaw
+            if (pitch < 0) {
+                yaw = T(pi) - yaw;
+            }
+        }
+
+        return BasicVector3<T>(roll, pitch, yaw);
+    }
 };
+
+typedef BasicQuaternion<double> Quaternion;
+typedef BasicQuaternion<float> Quaternionf;
+
 }  // namespace SimpleSlam::Math
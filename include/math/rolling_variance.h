@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stddef.h>
+
+namespace SimpleSlam::Math {
+
+/**
+ * Mean and variance over the last window values in O(1) per sample, using
+ * Welford's update while the window fills and its sliding form once full.
+ * Storage is a fixed ring buffer of N, the window may be set shorter at
+ * runtime. Nothing is allocated.
+ */
+template <size_t N>
+class RollingVariance {
+    static_assert(N > 0, "Window must hold at least one sample");
+
+   public:
+    /** window is clamped to [1, N] */
+    explicit RollingVariance(size_t window = N)
+        : _size{window < 1 ? 1 : window > N ? N : window} {}
+
+    void add(double value) {
+        if (_count < _size) {
+            _window[_head] = value;
+            _head = (_head + 1) % _size;
+            _count++;
+
+            const double delta = value - _mean;
+            _mean += delta / _count;
+            _m2 += delta * (value - _mean);
+            return;
+        }
+
+        // Window full, replace the oldest value
+        const double oldest = _window[_head];
+        _window[_head] = value;
+        _head = (_head + 1) % _size;
+
+        const double old_mean = _mean;
+        _mean += (value - oldest) / _size;
+        _m2 += (value - oldest) * (value - _mean + oldest - old_mean);
+        if (_m2 < 0) {
+            // Rounding can leave a tiny negative residue on a flat signal
+            _m2 = 0;
+        }
+    }
+
+    void reset() {
+        _head = 0;
+        _count = 0;
+        _mean = 0;
+        _m2 = 0;
+    }
+
+    size_t count() const { return _count; }
+    size_t window() const { return _size; }
+    double mean() const { return _mean; }
+
+    /** Population variance of the samples currently in the window */
+    double variance() const { return _count == 0 ? 0 : _m2 / _count; }
+
+   private:
+    double _window[N] = {};
+    size_t _size;
+    size_t _head = 0;
+    size_t _count = 0;
+    double _mean = 0;
+    double _m2 = 0;
+};
+
+}  // namespace SimpleSlam::Math
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace SimpleSlam::Math {
+
+/**
+ * Structure-of-arrays block of 3-axis samples. Each axis is contiguous so
+ * the kernels below run as one straight loop per axis, CMSIS-DSP on target
+ * and auto-vectorized on host.
+ */
+template <size_t N>
+struct SampleBlock {
+    static constexpr size_t CAPACITY = N;
+
+    float x[N];
+    float y[N];
+    float z[N];
+    size_t count = 0;
+};
+
+void Scale_Array(float* values, size_t count, float scale);
+
+/**
+ * Load count 3-axis samples into the block. field picks the int16_t[3]
+ * member to take from each sample, e.g. &imu_sample_t::gyro.
+ */
+template <size_t N, typename Sample>
+void Load_Block(SampleBlock<N>& block, const Sample* samples,
+                int16_t (Sample::*field)[3], size_t count) {
+    block.count = count < N ? count : N;
+    for (size_t i = 0; i < block.count; i++) {
+        const int16_t* values = samples[i].*field;
+        block.x[i] = values[0];
+        block.y[i] = values[1];
+        block.z[i] = values[2];
+    }
+}
+
+template <size_t N>
+void Scale_Block(SampleBlock<N>& block, float scale) {
+    Scale_Array(block.x, block.count, scale);
+    Scale_Array(block.y, block.count, scale);
+    Scale_Array(block.z, block.count, scale);
+}
+
+}  // namespace SimpleSlam::Math
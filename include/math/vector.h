@@ -1,49 +1,137 @@
 #pragma once
 
+#include <stddef.h>
+
+#include <cmath>
 #include <string>
 
 namespace SimpleSlam::Math {
 
-class Vector3 {
+/**
+ * Header-only so the arithmetic inlines into the fusion code. Use the float
+ * aliases on the target, the Cortex-M4 FPU is single precision only and
+ * double falls back to software routines. T may also be a FixedPoint type,
+ * sqrt is looked up by argument so its overload is found.
+ */
+template <typename T>
+class BasicVector3 {
    public:
-    Vector3(double x, double y, double z);
-    double dot(const Vector3& other) const;
-    Vector3 cross(const Vector3& other) const;
-    Vector3 normalize() const;
-    double operator[](const size_t& index) const;
-    Vector3 operator*(const double& scalar) const;
-    Vector3 operator/(const double& scalar) const;
-    Vector3 operator+(const Vector3& other) const;
-    Vector3 operator-(const Vector3& other) const;
-    double magnitude() const;
-    double get_x() const;
-    double get_y() const;
-    double get_z() const;
-    std::string to_string() const;
+    constexpr BasicVector3(T x, T y, T z) : _x{x}, _y{y}, _z{z} {}
+
+    template <typename U>
+    constexpr explicit BasicVector3(const BasicVector3<U>& other)
+        : _x{static_cast<T>(other.get_x())},
+          _y{static_cast<T>(other.get_y())},
+          _z{static_cast<T>(other.get_z())} {}
+
+    constexpr T dot(const BasicVector3& other) const {
+        return _x * other._x + _y * other._y + _z * other._z;
+    }
+
+    constexpr BasicVector3 cross(const BasicVector3& other) const {
+        return BasicVector3(_y * other._z - _z * other._y,
+                            _z * other._x - _x * other._z,
+                            _x * other._y - _y * other._x);
+    }
+
+    BasicVector3 normalize() const { return *this / magnitude(); }
+
+    constexpr T operator[](const size_t& index) const {
+        return index == 0 ? _x : index == 1 ? _y : _z;
+    }
+
+    constexpr BasicVector3 operator*(const T& scalar) const {
+        return BasicVector3(scalar * _x, scalar * _y, scalar * _z);
+    }
+
+    constexpr BasicVector3 operator/(const T& scalar) const {
+        return BasicVector3(_x / scalar, _y / scalar, _z / scalar);
+    }
+
+    constexpr BasicVector3 operator+(const BasicVector3& other) const {
+        return BasicVector3(_x + other._x, _y + other._y, _z + other._z);
+    }
+
+    constexpr BasicVector3 operator-(const BasicVector3& other) const {
+        return BasicVector3(_x - other._x, _y - other._y, _z - other._z);
+    }
+
+    T magnitude() const {
+        using std::sqrt;
+        return sqrt(dot(*this));
+    }
+
+    constexpr T get_x() const { return _x; }
+    constexpr T get_y() const { return _y; }
+    constexpr T get_z() const { return _z; }
+
+    std::string to_string() const {
+        return std::string()
+            .append("[")
+            .append(std::to_string(_x))
+            .append(", ")
+            .append(std::to_string(_y))
+            .append(", ")
+            .append(std::to_string(_z))
+            .append("]");
+    }
 
    private:
-    double _x{0};
-    double _y{0};
-    double _z{0};
+    T _x{0};
+    T _y{0};
+    T _z{0};
 };
 
-class Vector2 {
+template <typename T>
+class BasicVector2 {
    public:
-    Vector2(double x, double y);
-    Vector2(const Vector3& other);
-    Vector2 operator+(const Vector2& other) const;
-    Vector2 operator*(double scalar) const;
-    Vector2 operator/(double scalar) const;
-    Vector2 normalize() const;
-    static void normalize(Vector2& vector);
-    double magnitude() const;
-    double get_x() const;
-    double get_y() const;
-    std::string to_string() const;
+    constexpr BasicVector2(T x, T y) : _x{x}, _y{y} {}
+    constexpr BasicVector2(const BasicVector3<T>& other)
+        : _x{other.get_x()}, _y{other.get_y()} {}
+
+    template <typename U>
+    constexpr explicit BasicVector2(const BasicVector2<U>& other)
+        : _x{static_cast<T>(other.get_x())}, _y{static_cast<T>(other.get_y())} {}
+
+    constexpr BasicVector2 operator+(const BasicVector2& other) const {
+        return BasicVector2(_x + other._x, _y + other._y);
+    }
+
+    constexpr BasicVector2 operator*(T scalar) const {
+        return BasicVector2(scalar * _x, scalar * _y);
+    }
+
+    constexpr BasicVector2 operator/(T scalar) const {
+        return BasicVector2(_x / scalar, _y / scalar);
+    }
+
+    BasicVector2 normalize() const { return *this / magnitude(); }
+
+    T magnitude() const {
+        using std::sqrt;
+        return sqrt(_x * _x + _y * _y);
+    }
+
+    constexpr T get_x() const { return _x; }
+    constexpr T get_y() const { return _y; }
+
+    std::string to_string() const {
+        return std::string()
+            .append("[")
+            .append(std::to_string(_x))
+            .append(", ")
+            .append(std::to_string(_y))
+            .append("]");
+    }
 
    private:
-    double _x{0};
-    double _y{0};
+    T _x{0};
+    T _y{0};
 };
 
+typedef BasicVector3<double> Vector3;
+typedef BasicVector2<double> Vector2;
+typedef BasicVector3<float> Vector3f;
+typedef BasicVector2<float> Vector2f;
+
 }  // namespace SimpleSlam::Math
@@ -0,0 +1,174 @@
+package api
+
+import (
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"math"
+)
+
+// Binary point batch sent by the firmware as application/octet-stream.
+// Layout is documented in include/data/point_batch.h, all fields are
+// little endian.
+const (
+	pointBatchMagic      = "SLPB"
+	pointBatchVersion    = 1
+	pointBatchHeaderSize = 13
+)
+
+type pointEncoding uint8
+
+const (
+	pointEncodingFloat32 pointEncoding = 0
+	pointEncodingInt16Cm pointEncoding = 1
+	// Zigzag varint deltas in cm, each stream starts from a keyframe
+	pointEncodingDeltaVarintCm pointEncoding = 2
+)
+
+type pointBatch struct {
+	BoardID     boardID
+	TimestampMs uint32
+	Spatials    [][]float32
+	Positions   [][]float32
+}
+
+var errShortBatch = errors.New("point batch is truncated")
+
+func decodePointBatch(body []byte) (*pointBatch, error) {
+	if len(body) < pointBatchHeaderSize {
+		return nil, errShortBatch
+	}
+	if string(body[0:4]) != pointBatchMagic {
+		return nil, errors.New("not a point batch")
+	}
+	if body[4] != pointBatchVersion {
+		return nil, fmt.Errorf("unsupported point batch version %d", body[4])
+	}
+
+	encoding := pointEncoding(body[5])
+	var readPairs func(r *pairReader, count int) ([][]float32, error)
+	switch encoding {
+	case pointEncodingFloat32:
+		readPairs = readFloat32Pairs
+	case pointEncodingInt16Cm:
+		readPairs = readInt16Pairs
+	case pointEncodingDeltaVarintCm:
+		readPairs = readDeltaVarintPairs
+	default:
+		return nil, fmt.Errorf("unknown point encoding %d", encoding)
+	}
+
+	count := int(binary.LittleEndian.Uint16(body[6:8]))
+	timestamp := binary.LittleEndian.Uint32(body[8:12])
+	idLength := int(body[12])
+
+	r := &pairReader{body: body, offset: pointBatchHeaderSize}
+	idBytes, ok := r.next(idLength)
+	if !ok {
+		return nil, errShortBatch
+	}
+	id := boardID(idBytes)
+	if id == "" {
+		return nil, errors.New("point batch has no board id")
+	}
+
+	spatials, err := readPairs(r, count)
+	if err != nil {
+		return nil, err
+	}
+	positions, err := readPairs(r, count)
+	if err != nil {
+		return nil, err
+	}
+	if r.offset != len(body) {
+		return nil, errors.New("point batch has trailing bytes")
+	}
+	return &pointBatch{
+		BoardID:     id,
+		TimestampMs: timestamp,
+		Spatials:    spatials,
+		Positions:   positions,
+	}, nil
+}
+
+// pairReader walks the body of a point batch, checking every read against
+// its length.
+type pairReader struct {
+	body   []byte
+	offset int
+}
+
+func (r *pairReader) next(n int) ([]byte, bool) {
+	if n > len(r.body)-r.offset {
+		return nil, false
+	}
+	bytes := r.body[r.offset : r.offset+n]
+	r.offset += n
+	return bytes, true
+}
+
+// varint reads one zigzag encoded LEB128 value. The firmware never writes
+// more than 5 bytes for one, longer encodings are rejected even when they
+// pad a small value.
+func (r *pairReader) varint() (int32, error) {
+	value, n := binary.Uvarint(r.body[r.offset:])
+	if n == 0 {
+		return 0, errShortBatch
+	}
+	if n < 0 || n > binary.MaxVarintLen32 || value > math.MaxUint32 {
+		return 0, errors.New("point batch varint overflows 32 bits")
+	}
+	r.offset += n
+	return int32(uint32(value)>>1) ^ -int32(value&1), nil
+}
+
+func readFloat32Pairs(r *pairReader, count int) ([][]float32, error) {
+	pairs := make([][]float32, count)
+	for i := range pairs {
+		pair, ok := r.next(8)
+		if !ok {
+			return nil, errShortBatch
+		}
+		pairs[i] = []float32{
+			math.Float32frombits(binary.LittleEndian.Uint32(pair[0:4])),
+			math.Float32frombits(binary.LittleEndian.Uint32(pair[4:8])),
+		}
+	}
+	return pairs, nil
+}
+
+func readInt16Pairs(r *pairReader, count int) ([][]float32, error) {
+	pairs := make([][]float32, count)
+	for i := range pairs {
+		pair, ok := r.next(4)
+		if !ok {
+			return nil, errShortBatch
+		}
+		pairs[i] = []float32{
+			float32(int16(binary.LittleEndian.Uint16(pair[0:2]))),
+			float32(int16(binary.LittleEndian.Uint16(pair[2:4]))),
+		}
+	}
+	return pairs, nil
+}
+
+// readDeltaVarintPairs undoes the delta coding of one stream, the first
+// pair is a keyframe relative to the origin.
+func readDeltaVarintPairs(r *pairReader, count int) ([][]float32, error) {
+	pairs := make([][]float32, count)
+	var x, y int32
+	for i := range pairs {
+		dx, err := r.varint()
+		if err != nil {
+			return nil, err
+		}
+		dy, err := r.varint()
+		if err != nil {
+			return nil, err
+		}
+		x += dx
+		y += dy
+		pairs[i] = []float32{float32(x), float32(y)}
+	}
+	return pairs, nil
+}
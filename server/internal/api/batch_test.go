@@ -0,0 +1,163 @@
+package api
+
+import (
+	"errors"
+	"reflect"
+	"testing"
+)
+
+// Written by PointBatchWriter for board "b1" at 123456 ms, spatials
+// (1.24, -2.5), (3, 400.6) then positions (-1, 0), (70000.4, -0.4). The same
+// bytes are checked on the firmware side in test/test_point_batch.
+var (
+	float32Batch = []byte{
+		0x53, 0x4c, 0x50, 0x42, 0x01, 0x00, 0x02, 0x00, 0x40, 0xe2, 0x01, 0x00,
+		0x02, 0x62, 0x31,
+		0x52, 0xb8, 0x9e, 0x3f, 0x00, 0x00, 0x20, 0xc0,
+		0x00, 0x00, 0x40, 0x40, 0xcd, 0x4c, 0xc8, 0x43,
+		0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x00, 0x00,
+		0x33, 0xb8, 0x88, 0x47, 0xcd, 0xcc, 0xcc, 0xbe,
+	}
+	int16Batch = []byte{
+		0x53, 0x4c, 0x50, 0x42, 0x01, 0x01, 0x02, 0x00, 0x40, 0xe2, 0x01, 0x00,
+		0x02, 0x62, 0x31,
+		0x01, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x91, 0x01,
+		0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00,
+	}
+	deltaVarintBatch = []byte{
+		0x53, 0x4c, 0x50, 0x42, 0x01, 0x02, 0x02, 0x00, 0x40, 0xe2, 0x01, 0x00,
+		0x02, 0x62, 0x31,
+		0x02, 0x05, 0x04, 0xa8, 0x06,
+		0x01, 0x00, 0xe2, 0xc5, 0x08, 0x00,
+	}
+)
+
+// deltaVarintBody is a delta varint batch of count points for board "b1"
+// with the given pair bytes after the header.
+func deltaVarintBody(count byte, pairs ...byte) []byte {
+	header := []byte{
+		0x53, 0x4c, 0x50, 0x42, 0x01, 0x02, count, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x62, 0x31,
+	}
+	return append(header, pairs...)
+}
+
+func TestDecodePointBatch(t *testing.T) {
+	tests := []struct {
+		name string
+		body []byte
+		want *pointBatch
+	}{
+		{
+			name: "float32",
+			body: float32Batch,
+			want: &pointBatch{
+				BoardID:     "b1",
+				TimestampMs: 123456,
+				Spatials:    [][]float32{{1.24, -2.5}, {3, 400.6}},
+				Positions:   [][]float32{{-1, 0}, {70000.4, -0.4}},
+			},
+		},
+		{
+			name: "int16 cm saturates",
+			body: int16Batch,
+			want: &pointBatch{
+				BoardID:     "b1",
+				TimestampMs: 123456,
+				Spatials:    [][]float32{{1, -3}, {3, 401}},
+				Positions:   [][]float32{{-1, 0}, {32767, 0}},
+			},
+		},
+		{
+			name: "delta varint cm restarts at the positions keyframe",
+			body: deltaVarintBatch,
+			want: &pointBatch{
+				BoardID:     "b1",
+				TimestampMs: 123456,
+				Spatials:    [][]float32{{1, -3}, {3, 401}},
+				Positions:   [][]float32{{-1, 0}, {70000, 0}},
+			},
+		},
+		{
+			name: "delta varint at the 2^30 clamp",
+			// Written by PointBatchWriter for spatials (1e12, -1e12),
+			// (-1e12, 1e12). Each axis clamps to +-(2^30 - 1) and the swing
+			// between them fills the 5 bytes the firmware writes at most.
+			body: deltaVarintBody(2,
+				0xfe, 0xff, 0xff, 0xff, 0x07, 0xfd, 0xff, 0xff, 0xff, 0x07,
+				0xfb, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0x0f,
+				0x00, 0x00, 0x00, 0x00),
+			want: &pointBatch{
+				BoardID: "b1",
+				Spatials: [][]float32{
+					{1<<30 - 1, -(1<<30 - 1)},
+					{-(1<<30 - 1), 1<<30 - 1},
+				},
+				Positions: [][]float32{{0, 0}, {0, 0}},
+			},
+		},
+	}
+	for _, test := range tests {
+		t.Run(test.name, func(t *testing.T) {
+			got, err := decodePointBatch(test.body)
+			if err != nil {
+				t.Fatalf("decodePointBatch() error = %v", err)
+			}
+			if !reflect.DeepEqual(got, test.want) {
+				t.Errorf("decodePointBatch() = %+v, want %+v", got, test.want)
+			}
+		})
+	}
+}
+
+func TestDecodePointBatchTruncated(t *testing.T) {
+	bodies := map[string][]byte{
+		"float32":         float32Batch,
+		"int16 cm":        int16Batch,
+		"delta varint cm": deltaVarintBatch,
+	}
+	for name, body := range bodies {
+		t.Run(name, func(t *testing.T) {
+			for length := 0; length < len(body); length++ {
+				_, err := decodePointBatch(body[:length])
+				if !errors.Is(err, errShortBatch) {
+					t.Errorf("%d of %d bytes: error = %v, want %v",
+						length, len(body), err, errShortBatch)
+				}
+			}
+		})
+	}
+}
+
+func TestDecodePointBatchRejects(t *testing.T) {
+	withByte := func(body []byte, index int, value byte) []byte {
+		changed := append([]byte(nil), body...)
+		changed[index] = value
+		return changed
+	}
+	tests := []struct {
+		name string
+		body []byte
+	}{
+		{"bad magic", withByte(int16Batch, 0, 'X')},
+		{"unsupported version", withByte(int16Batch, 4, 2)},
+		{"unknown encoding", withByte(int16Batch, 5, 3)},
+		{"empty board id", withByte(int16Batch[:13], 12, 0)},
+		{"trailing bytes float32", append(append([]byte(nil), float32Batch...), 0)},
+		{"trailing bytes int16 cm", append(append([]byte(nil), int16Batch...), 0)},
+		{"trailing bytes delta varint", append(append([]byte(nil), deltaVarintBatch...), 0)},
+		{"varint past 32 bits", deltaVarintBody(1, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x00, 0x00, 0x00)},
+		{"varint past 64 bits", deltaVarintBody(1,
+			0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+			0x00, 0x00, 0x00)},
+		{"over-long varint for a small value", deltaVarintBody(1,
+			0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00)},
+	}
+	for _, test := range tests {
+		t.Run(test.name, func(t *testing.T) {
+			if batch, err := decodePointBatch(test.body); err == nil {
+				t.Errorf("decodePointBatch() = %+v, want an error", batch)
+			}
+		})
+	}
+}
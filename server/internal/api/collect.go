@@ -1,7 +1,9 @@
 package api
 
 import (
+	"io"
 	"net/http"
+	"strings"
 
 	"github.com/labstack/echo/v4"
 )
@@ -15,13 +17,32 @@ type collectRequest struct {
 func collect(c echo.Context) error {
 	var cr collectRequest
 
-	err := c.Bind(&cr)
-	if err != nil {
-		c.Logger().Errorf("Invalid collect request body: %s", err)
-		return echo.NewHTTPError(http.StatusBadRequest, "Invalid request body")
+	contentType := c.Request().Header.Get(echo.HeaderContentType)
+	if strings.HasPrefix(contentType, echo.MIMEOctetStream) {
+		body, err := io.ReadAll(c.Request().Body)
+		if err != nil {
+			return echo.NewHTTPError(http.StatusBadRequest, "Invalid request body")
+		}
+
+		batch, err := decodePointBatch(body)
+		if err != nil {
+			c.Logger().Errorf("Invalid point batch: %s", err)
+			return echo.NewHTTPError(http.StatusBadRequest, "Invalid request body")
+		}
+		cr = collectRequest{
+			BoardID:   batch.BoardID,
+			Spatials:  batch.Spatials,
+			Positions: batch.Positions,
+		}
+	} else {
+		err := c.Bind(&cr)
+		if err != nil {
+			c.Logger().Errorf("Invalid collect request body: %s", err)
+			return echo.NewHTTPError(http.StatusBadRequest, "Invalid request body")
+		}
 	}
 
-	err = c.Validate(&cr)
+	err := c.Validate(&cr)
 	if err != nil {
 		return err
 	}
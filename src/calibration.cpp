@@ -1,28 +1,67 @@
 #include "calibration.h"
 
+#include <stddef.h>
+#include <string.h>
+
+#include <type_traits>
+
 #include "driver/lis3mdl.h"
 #include "driver/lsm6dsl.h"
+#include "math/magnetometer_calibrator.h"
+
+// Stored calibration lives in the flash page after the application region,
+// mbed_app.json shrinks the ROM size by one page to leave it free.
+#define CALIBRATION_MAGIC 0x534C4D43  // "SLMC"
+// Bump whenever calibration_data_t changes layout
+#define CALIBRATION_VERSION 1
+// STM32L4 programs flash a double word at a time
+#define CALIBRATION_PROGRAM_ALIGNMENT 8
+
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t size;
+    SimpleSlam::calibration_data_t data;
+    uint32_t crc;  // Over every field above
+} calibration_record_t;
+
+// The CRC covers the raw bytes, so there must be no padding before crc
+static_assert(offsetof(calibration_record_t, crc) ==
+                  8 + sizeof(SimpleSlam::calibration_data_t),
+              "Calibration record has interior padding");
+
+static_assert(std::is_trivially_copyable<SimpleSlam::calibration_data_t>::value,
+              "Calibration is stored as raw bytes");
+
+static constexpr size_t CALIBRATION_PROGRAM_SIZE =
+    (sizeof(calibration_record_t) + CALIBRATION_PROGRAM_ALIGNMENT - 1) /
+    CALIBRATION_PROGRAM_ALIGNMENT * CALIBRATION_PROGRAM_ALIGNMENT;
+
+static uint32_t calibration_record_crc(const calibration_record_t& record) {
+    MbedCRC<POLY_32BIT_ANSI, 32> crc;
+    uint32_t result = 0;
+    crc.compute(&record, offsetof(calibration_record_t, crc), &result);
+    return result;
+}
 
 void calibrate_accel_gyro(DigitalOut* calibration_indicator_led,
                           SimpleSlam::calibration_data_t* calibration_data) {
     printf("Calibrating Accelerometer and Gyroscope\n");
     *calibration_indicator_led = 1;
 
-    int16_t accel_buffer[3];
-    int16_t gyro_buffer[3];
+    SimpleSlam::LSM6DSL::imu_sample_t imu_sample;
 
     SimpleSlam::Math::Vector3 gyro_offset(0, 0, 0);
     SimpleSlam::Math::Vector3 accel_offset(0, 0, 0);
 
     const int num_samples = 500;
     for (size_t i = 0; i < num_samples; i++) {
-        SimpleSlam::LSM6DSL::Gyro_Read(gyro_buffer);
-        SimpleSlam::LSM6DSL::Accel_Read(accel_buffer);
+        SimpleSlam::LSM6DSL::Read_IMU(imu_sample);
 
         const SimpleSlam::Math::Vector3 temp_accel(
-            accel_buffer[0], accel_buffer[1], accel_buffer[2]);
-        const SimpleSlam::Math::Vector3 temp_ang(gyro_buffer[0], gyro_buffer[1],
-                                                 gyro_buffer[2]);
+            imu_sample.accel[0], imu_sample.accel[1], imu_sample.accel[2]);
+        const SimpleSlam::Math::Vector3 temp_ang(
+            imu_sample.gyro[0], imu_sample.gyro[1], imu_sample.gyro[2]);
         gyro_offset = gyro_offset + temp_ang;
         accel_offset = accel_offset + temp_accel;
         ThisThread::sleep_for(20ms);
@@ -48,7 +87,7 @@ void calibrate_magnetometer(DigitalOut* calibration_indicator_led,
     *calibration_indicator_led = 1;
 
     int16_t magno_buffer[3];
-    std::vector<SimpleSlam::Math::Vector3> readings;
+    SimpleSlam::Math::MagnetometerCalibrator calibrator;
 
     const int num_samples = 500;
     for (int i = 0; i < num_samples; i++) {
@@ -56,12 +95,12 @@ void calibrate_magnetometer(DigitalOut* calibration_indicator_led,
                                      magno_buffer[2]);
         SimpleSlam::Math::Vector3 temp_magno(magno_buffer[0], magno_buffer[1],
                                              magno_buffer[2]);
-        readings.push_back(temp_magno);
+        calibrator.add(temp_magno);
         ThisThread::sleep_for(20ms);
     }
 
     calibration_data->magnetometer_calibration_data =
-        SimpleSlam::Math::Fill_Magnetometer_Calibration_Data(readings);
+        calibrator.solve();
 
     *calibration_indicator_led = 0;
     printf("Finished Magnometer Calibration\n");
@@ -89,3 +128,62 @@ void SimpleSlam::Handle_Calibration_Step_Change(calibration_args_t* args) {
             break;
     }
 }
+
+bool SimpleSlam::Load_Calibration(calibration_data_t* calibration_data) {
+    FlashIAP flash;
+    if (flash.init() != 0) {
+        return false;
+    }
+
+    // Placeholder contents, overwritten by the read
+    calibration_record_t record{0, 0, 0, *calibration_data, 0};
+    const int status =
+        flash.read(&record, FLASHIAP_APP_ROM_END_ADDR, sizeof(record));
+    flash.deinit();
+    if (status != 0) {
+        return false;
+    }
+
+    if (record.magic != CALIBRATION_MAGIC ||
+        record.version != CALIBRATION_VERSION ||
+        record.size != sizeof(calibration_data_t) ||
+        record.crc != calibration_record_crc(record)) {
+        return false;
+    }
+
+    *calibration_data = record.data;
+    return true;
+}
+
+bool SimpleSlam::Save_Calibration(const calibration_data_t* calibration_data) {
+    FlashIAP flash;
+    if (flash.init() != 0) {
+        return false;
+    }
+
+    const uint32_t address = FLASHIAP_APP_ROM_END_ADDR;
+    const uint32_t sector_size = flash.get_sector_size(address);
+    const bool fits =
+        address + sector_size <= flash.get_flash_start() + flash.get_flash_size() &&
+        CALIBRATION_PROGRAM_SIZE <= sector_size &&
+        CALIBRATION_PROGRAM_SIZE % flash.get_page_size() == 0;
+    if (!fits) {
+        printf("No flash reserved for calibration\n");
+        flash.deinit();
+        return false;
+    }
+
+    // Padding is written as erased flash so it reads back the same
+    alignas(CALIBRATION_PROGRAM_ALIGNMENT) uint8_t buffer[CALIBRATION_PROGRAM_SIZE];
+    memset(buffer, flash.get_erase_value(), sizeof(buffer));
+
+    calibration_record_t record{CALIBRATION_MAGIC, CALIBRATION_VERSION,
+                                sizeof(calibration_data_t), *calibration_data, 0};
+    record.crc = calibration_record_crc(record);
+    memcpy(buffer, &record, sizeof(record));
+
+    const bool saved = flash.erase(address, sector_size) == 0 &&
+                       flash.program(buffer, address, sizeof(buffer)) == 0;
+    flash.deinit();
+    return saved;
+}
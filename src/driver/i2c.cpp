@@ -1,6 +1,8 @@
 #include "driver/i2c.h"
 
 static I2C_HandleTypeDef i2c_handler;
+static SimpleSlam::I2CSpeed i2c_speed = SimpleSlam::I2CSpeed::STANDARD_100KHZ;
+static volatile uint32_t transaction_count = 0;
 
 static void scl_sda_gpio_init() {
     SCL_SDA_GPIO_CLK_ENABLE();
@@ -23,15 +25,32 @@ static void scl_sda_gpio_deinit() {
     INTERNAL_I2C_CLK_DISABLE();
 }
 
-static void handle_i2c_error() {
+static void handle_i2c_error(HAL_StatusTypeDef status) {
+    // HAL_BUSY means a DMA transfer owns the bus, the bus itself is fine
+    if (status == HAL_BUSY) {
+        return;
+    }
     SimpleSlam::I2C_DeInit();
     SimpleSlam::I2C_Init();
 }
 
 void SimpleSlam::I2C_Init() {
+    I2C_Init(i2c_speed);
+}
+
+void SimpleSlam::I2C_Init(I2CSpeed speed) {
+    i2c_speed = speed;
+
+    uint32_t timing = I2C_Compute_Timing(HAL_RCCEx_GetPeriphCLKFreq(INTERNAL_I2C_PERIPHCLK), speed);
+    if (timing == 0) {
+        // Kernel clock too slow for this speed, fall back to Standard-mode
+        i2c_speed = I2CSpeed::STANDARD_100KHZ;
+        timing = I2C_Compute_Timing(HAL_RCCEx_GetPeriphCLKFreq(INTERNAL_I2C_PERIPHCLK), i2c_speed);
+    }
+
     // Setup the I2C initialization parameters
     i2c_handler.Instance              = I2C2;
-    i2c_handler.Init.Timing           = I2C_TIMINGR;
+    i2c_handler.Init.Timing           = timing;
     i2c_handler.Init.OwnAddress1      = 0;
     i2c_handler.Init.AddressingMode   = I2C_ADDRESSINGMODE_7BIT;
     i2c_handler.Init.DualAddressMode  = I2C_DUALADDRESS_DISABLE;
@@ -51,6 +70,15 @@ void SimpleSlam::I2C_Init() {
     HAL_I2CEx_ConfigAnalogFilter(&i2c_handler, I2C_ANALOGFILTER_ENABLE); 
 
     HAL_I2C_Init(&i2c_handler);
+
+    // Fast-mode Plus needs the stronger 20mA drive on SCL/SDA
+    // reference: RM0351 Section 39.4.16: I2C_FMP bits in SYSCFG_CFGR1
+    __HAL_RCC_SYSCFG_CLK_ENABLE();
+    if (i2c_speed == I2CSpeed::FAST_PLUS_1MHZ) {
+        HAL_I2CEx_EnableFastModePlus(INTERNAL_I2C_FASTMODEPLUS);
+    } else {
+        HAL_I2CEx_DisableFastModePlus(INTERNAL_I2C_FASTMODEPLUS);
+    }
 }
 
 void SimpleSlam::I2C_DeInit() {
@@ -58,16 +86,29 @@ void SimpleSlam::I2C_DeInit() {
     HAL_I2C_DeInit(&i2c_handler);
 }
 
+I2C_HandleTypeDef* SimpleSlam::I2C_Get_Handle() {
+    return &i2c_handler;
+}
+
+uint32_t SimpleSlam::I2C_Get_Transaction_Count() {
+    return transaction_count;
+}
+
+void SimpleSlam::I2C_Count_Transaction() {
+    transaction_count = transaction_count + 1;
+}
+
 HAL_StatusTypeDef SimpleSlam::I2C_Mem_Write(
     uint16_t peripheral_address, uint16_t reg_address, uint16_t reg_address_size, 
     uint8_t *buffer, uint16_t size
 ) {
+    I2C_Count_Transaction();
     HAL_StatusTypeDef status = HAL_I2C_Mem_Write(
         &i2c_handler, peripheral_address, reg_address, 
         reg_address_size, buffer, size, TIMEOUT_US);
 
     if (status != HAL_OK) {
-       handle_i2c_error();
+       handle_i2c_error(status);
     }
     return status;
 }
@@ -75,13 +116,14 @@ HAL_StatusTypeDef SimpleSlam::I2C_Mem_Write(
 HAL_StatusTypeDef SimpleSlam::I2C_Mem_Write_Single(
     uint16_t peripheral_address, uint16_t reg_address, uint8_t value
 ) {
+    I2C_Count_Transaction();
     HAL_StatusTypeDef status = HAL_I2C_Mem_Write(
         &i2c_handler, peripheral_address, reg_address, ADDR_SIZE_8,
         &value, SINGLE_SIZE, TIMEOUT_US
     );
 
     if (status != HAL_OK) {
-       handle_i2c_error();
+       handle_i2c_error(status);
     }
     return status;
 }
@@ -90,13 +132,14 @@ HAL_StatusTypeDef SimpleSlam::I2C_Mem_Read(
     uint16_t peripheral_address, uint16_t reg_address, uint16_t reg_address_size, 
     uint8_t *buffer, uint16_t size
 ) {
+    I2C_Count_Transaction();
     HAL_StatusTypeDef status = HAL_I2C_Mem_Read(
         &i2c_handler, peripheral_address, reg_address, reg_address_size, 
         buffer, size, TIMEOUT_US
     );
 
     if (status != HAL_OK) {
-        handle_i2c_error();
+        handle_i2c_error(status);
     }
     return status;
 }
@@ -105,13 +148,27 @@ HAL_StatusTypeDef SimpleSlam::I2C_Mem_Read(
 HAL_StatusTypeDef SimpleSlam::I2C_Mem_Read_Single(
     uint16_t peripheral_address, uint16_t reg_address, uint8_t *buffer
 ) {
+    I2C_Count_Transaction();
     HAL_StatusTypeDef status = HAL_I2C_Mem_Read(
         &i2c_handler, peripheral_address, reg_address, ADDR_SIZE_8, buffer, 
         SINGLE_SIZE, TIMEOUT_US
     );
 
     if (status != HAL_OK) {
-        handle_i2c_error();
+        handle_i2c_error(status);
     }
     return status;
 }
+
+HAL_StatusTypeDef SimpleSlam::I2C_Write_Sequence(
+    uint16_t peripheral_address, const i2c_register_write_t* writes, size_t count
+) {
+    for (size_t i = 0; i < count; i++) {
+        HAL_StatusTypeDef status = I2C_Mem_Write_Single(
+            peripheral_address, writes[i].reg_address, writes[i].value);
+        if (status != HAL_OK) {
+            return status;
+        }
+    }
+    return HAL_OK;
+}
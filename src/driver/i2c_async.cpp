@@ -0,0 +1,246 @@
+#include "driver/i2c_async.h"
+
+static DMA_HandleTypeDef dma_rx_handler;
+static DMA_HandleTypeDef dma_tx_handler;
+
+static CircularBuffer<SimpleSlam::i2c_transaction_t*, I2C_ASYNC_QUEUE_SIZE> pending_transactions;
+static SimpleSlam::i2c_transaction_t* volatile active_transaction = nullptr;
+static bool is_initialized = false;
+
+static void start_next_transaction();
+
+static void complete_transaction(SimpleSlam::i2c_transaction_t* transaction, HAL_StatusTypeDef status) {
+    transaction->status = status;
+    transaction->done = true;
+    if (transaction->flags != nullptr) {
+        transaction->flags->set(transaction->flag_mask);
+    }
+    if (transaction->on_complete) {
+        transaction->on_complete(transaction);
+    }
+}
+
+/**
+ * Finish the active transaction and chain the next queued one.
+ * Only called from interrupt context.
+*/
+static void complete_active_transaction(HAL_StatusTypeDef status) {
+    SimpleSlam::i2c_transaction_t* transaction = active_transaction;
+    if (transaction == nullptr) {
+        return;
+    }
+    active_transaction = nullptr;
+    complete_transaction(transaction, status);
+    start_next_transaction();
+}
+
+/**
+ * Must run with interrupts masked or from interrupt context.
+*/
+static void start_next_transaction() {
+    SimpleSlam::i2c_transaction_t* transaction;
+    while (active_transaction == nullptr && pending_transactions.pop(transaction)) {
+        HAL_StatusTypeDef status;
+        if (transaction->type == SimpleSlam::I2CTransactionType::READ) {
+            status = HAL_I2C_Mem_Read_DMA(
+                SimpleSlam::I2C_Get_Handle(), transaction->peripheral_address,
+                transaction->reg_address, transaction->reg_address_size,
+                transaction->buffer, transaction->size);
+        } else {
+            status = HAL_I2C_Mem_Write_DMA(
+                SimpleSlam::I2C_Get_Handle(), transaction->peripheral_address,
+                transaction->reg_address, transaction->reg_address_size,
+                transaction->buffer, transaction->size);
+        }
+
+        if (status == HAL_OK) {
+            active_transaction = transaction;
+        } else {
+            complete_transaction(transaction, status);
+        }
+    }
+}
+
+/**
+ * HAL_I2C_ErrorCallback is owned by mbed's own I2C driver, so transfer
+ * errors are picked up here once the HAL has aborted the transfer.
+*/
+static void check_transfer_error() {
+    I2C_HandleTypeDef* handle = SimpleSlam::I2C_Get_Handle();
+    if (active_transaction != nullptr &&
+        HAL_I2C_GetError(handle) != HAL_I2C_ERROR_NONE &&
+        HAL_I2C_GetState(handle) == HAL_I2C_STATE_READY) {
+        complete_active_transaction(HAL_ERROR);
+    }
+}
+
+static void i2c_ev_irq_handler() {
+    HAL_I2C_EV_IRQHandler(SimpleSlam::I2C_Get_Handle());
+    check_transfer_error();
+}
+
+static void i2c_er_irq_handler() {
+    HAL_I2C_ER_IRQHandler(SimpleSlam::I2C_Get_Handle());
+    check_transfer_error();
+}
+
+static void dma_rx_irq_handler() {
+    HAL_DMA_IRQHandler(&dma_rx_handler);
+    check_transfer_error();
+}
+
+static void dma_tx_irq_handler() {
+    HAL_DMA_IRQHandler(&dma_tx_handler);
+    check_transfer_error();
+}
+
+extern "C" void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef* hi2c) {
+    if (hi2c == SimpleSlam::I2C_Get_Handle()) {
+        complete_active_transaction(HAL_OK);
+    }
+}
+
+extern "C" void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef* hi2c) {
+    if (hi2c == SimpleSlam::I2C_Get_Handle()) {
+        complete_active_transaction(HAL_OK);
+    }
+}
+
+static void dma_channel_init(DMA_HandleTypeDef* dma_handler, DMA_Channel_TypeDef* channel, uint32_t direction) {
+    dma_handler->Instance                 = channel;
+    dma_handler->Init.Request             = I2C_DMA_REQUEST;
+    dma_handler->Init.Direction           = direction;
+    dma_handler->Init.PeriphInc           = DMA_PINC_DISABLE;
+    dma_handler->Init.MemInc              = DMA_MINC_ENABLE;
+    dma_handler->Init.PeriphDataAlignment = DMA_PDATAALIGN_BYTE;
+    dma_handler->Init.MemDataAlignment    = DMA_MDATAALIGN_BYTE;
+    dma_handler->Init.Mode                = DMA_NORMAL;
+    dma_handler->Init.Priority            = DMA_PRIORITY_HIGH;
+    HAL_DMA_Init(dma_handler);
+}
+
+static void irq_init(IRQn_Type irq, void (*handler)()) {
+    NVIC_SetVector(irq, (uintptr_t)handler);
+    NVIC_EnableIRQ(irq);
+}
+
+void SimpleSlam::I2C_Async_Init() {
+    I2C_HandleTypeDef* handle = I2C_Get_Handle();
+
+    I2C_DMA_CLK_ENABLE();
+    dma_channel_init(&dma_rx_handler, I2C_DMA_RX_CHANNEL, DMA_PERIPH_TO_MEMORY);
+    dma_channel_init(&dma_tx_handler, I2C_DMA_TX_CHANNEL, DMA_MEMORY_TO_PERIPH);
+    __HAL_LINKDMA(handle, hdmarx, dma_rx_handler);
+    __HAL_LINKDMA(handle, hdmatx, dma_tx_handler);
+
+    irq_init(I2C_DMA_RX_IRQN, dma_rx_irq_handler);
+    irq_init(I2C_DMA_TX_IRQN, dma_tx_irq_handler);
+    irq_init(I2C_EV_IRQN, i2c_ev_irq_handler);
+    irq_init(I2C_ER_IRQN, i2c_er_irq_handler);
+
+    is_initialized = true;
+}
+
+void SimpleSlam::I2C_Async_DeInit() {
+    NVIC_DisableIRQ(I2C_EV_IRQN);
+    NVIC_DisableIRQ(I2C_ER_IRQN);
+    NVIC_DisableIRQ(I2C_DMA_RX_IRQN);
+    NVIC_DisableIRQ(I2C_DMA_TX_IRQN);
+
+    HAL_DMA_DeInit(&dma_rx_handler);
+    HAL_DMA_DeInit(&dma_tx_handler);
+
+    I2C_HandleTypeDef* handle = I2C_Get_Handle();
+    handle->hdmarx = nullptr;
+    handle->hdmatx = nullptr;
+
+    // Anything still queued will never run, fail it rather than leave waiters hanging
+    i2c_transaction_t* transaction;
+    while (pending_transactions.pop(transaction)) {
+        complete_transaction(transaction, HAL_ERROR);
+    }
+    if (active_transaction != nullptr) {
+        transaction = active_transaction;
+        active_transaction = nullptr;
+        complete_transaction(transaction, HAL_ERROR);
+    }
+
+    is_initialized = false;
+}
+
+HAL_StatusTypeDef SimpleSlam::I2C_Async_Submit(i2c_transaction_t* transaction) {
+    transaction->done = false;
+    transaction->status = HAL_BUSY;
+
+    core_util_critical_section_enter();
+    if (!is_initialized || pending_transactions.full()) {
+        core_util_critical_section_exit();
+        return is_initialized ? HAL_BUSY : HAL_ERROR;
+    }
+
+    pending_transactions.push(transaction);
+    SimpleSlam::I2C_Count_Transaction();
+    if (active_transaction == nullptr) {
+        start_next_transaction();
+    }
+    core_util_critical_section_exit();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef SimpleSlam::I2C_Async_Wait(i2c_transaction_t* transaction, uint32_t timeout_ms) {
+    if (transaction->flags != nullptr) {
+        transaction->flags->wait_all(transaction->flag_mask, timeout_ms);
+    } else {
+        uint32_t start = HAL_GetTick();
+        while (!transaction->done && (HAL_GetTick() - start) < timeout_ms) {
+        }
+    }
+    return transaction->done ? transaction->status : HAL_TIMEOUT;
+}
+
+bool SimpleSlam::I2C_Async_Is_Idle() {
+    core_util_critical_section_enter();
+    bool is_idle = active_transaction == nullptr && pending_transactions.empty();
+    core_util_critical_section_exit();
+    return is_idle;
+}
+
+HAL_StatusTypeDef SimpleSlam::I2C_Async_Mem_Read(
+    uint16_t peripheral_address, uint16_t reg_address, uint16_t reg_address_size,
+    uint8_t *buffer, uint16_t size
+) {
+    if (!is_initialized) {
+        return I2C_Mem_Read(peripheral_address, reg_address, reg_address_size, buffer, size);
+    }
+
+    static EventFlags read_flags;
+    const uint32_t read_done_flag = 0x01;
+    read_flags.clear(read_done_flag);
+
+    i2c_transaction_t transaction{
+        .type = I2CTransactionType::READ,
+        .peripheral_address = peripheral_address,
+        .reg_address = reg_address,
+        .reg_address_size = reg_address_size,
+        .buffer = buffer,
+        .size = size,
+        .on_complete = nullptr,
+        .flags = &read_flags,
+        .flag_mask = read_done_flag,
+    };
+
+    HAL_StatusTypeDef status = I2C_Async_Submit(&transaction);
+    if (status != HAL_OK) {
+        return status;
+    }
+
+    status = I2C_Async_Wait(&transaction, TIMEOUT_US);
+    if (status == HAL_TIMEOUT) {
+        // Reset the bus so the DMA lets go of the buffer before returning
+        I2C_Async_DeInit();
+        I2C_DeInit();
+        I2C_Init();
+        I2C_Async_Init();
+    }
+    return status;
+}
@@ -4,6 +4,7 @@
  */
 
 #include "driver/lis3mdl.h"
+#include "driver/i2c_async.h"
 
 #define RETURN_IF_CONTAINS_ERROR(maybe_error) \
     if (maybe_error.has_value()) {            \
@@ -14,6 +15,62 @@
         return std::make_optional(std::make_pair(code, message)); \
     }
 
+// Cached at Init so reads do not have to fetch control register 2
+static uint16_t sensitivity = SENSITIVITY_4G;
+
+static void on_xyz_read(SimpleSlam::i2c_transaction_t* transaction);
+
+// Async XYZ read, owned by the driver until Get_XYZ collects it
+static uint8_t xyz_buffer[6];
+static mbed::Callback<void()> xyz_read_complete;
+static volatile bool xyz_read_pending = false;
+static SimpleSlam::i2c_transaction_t xyz_transaction{
+    .type = SimpleSlam::I2CTransactionType::READ,
+    .peripheral_address = LIS3MDL_I2C_DEVICE_ADDRESS,
+    .reg_address = REG_X_L | LIS3MDL_AUTO_INCREMENT,
+    .reg_address_size = I2C_MEMADD_SIZE_8BIT,
+    .buffer = xyz_buffer,
+    .size = sizeof(xyz_buffer),
+    .on_complete = on_xyz_read,
+    .flags = nullptr,
+    .flag_mask = 0,
+};
+
+static void on_xyz_read(SimpleSlam::i2c_transaction_t* transaction) {
+    if (xyz_read_complete) {
+        xyz_read_complete();
+    }
+}
+
+// Each axis is low byte first
+static void decode_xyz(const uint8_t* buffer, int16_t& x, int16_t& y, int16_t& z) {
+    x = (int16_t)((buffer[1] << 8) | buffer[0]);
+    y = (int16_t)((buffer[3] << 8) | buffer[2]);
+    z = (int16_t)((buffer[5] << 8) | buffer[4]);
+}
+
+// The data sheet uses LSB/gauss, but we want mGauss. Scale up before
+// dividing so the integer math keeps the precision.
+static void scale_to_milligauss(int16_t& x, int16_t& y, int16_t& z) {
+    x = (int16_t)((int32_t)x * 1000 / sensitivity);
+    y = (int16_t)((int32_t)y * 1000 / sensitivity);
+    z = (int16_t)((int32_t)z * 1000 / sensitivity);
+}
+
+static uint16_t full_scale_to_sensitivity(uint8_t full_scale) {
+    switch (full_scale) {
+        case LOPTS_FULL_SCALE_8_GAUSS:
+            return SENSITIVITY_8G;
+        case LOPTS_FULL_SCALE_12_GAUSS:
+            return SENSITIVITY_12G;
+        case LOPTS_FULL_SCALE_16_GAUSS:
+            return SENSITIVITY_16G;
+        case LOPTS_FULL_SCALE_4_GAUSS:
+        default:
+            return SENSITIVITY_4G;
+    }
+}
+
 /**
  * Initialize the LIS3MDL module
  * @param config Configuration for the LIS3MDL module
@@ -55,6 +112,7 @@ std::optional<SimpleSlam::LIS3MDL::error_t> SimpleSlam::LIS3MDL::Init(
         I2C_Mem_Write_Single(LIS3MDL_I2C_DEVICE_ADDRESS, REG_CTRL_2, regValue);
     RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR,
                             "Error writing to control register 2");
+    sensitivity = full_scale_to_sensitivity(fullScale);
 
     // Control Register 3
     // 0, 0, LP, 0, 0, SIM, MD1, MD0
@@ -93,71 +151,77 @@ std::optional<SimpleSlam::LIS3MDL::error_t> SimpleSlam::LIS3MDL::Init(
 }
 
 /**
- * Read the X, Y, and Z values from the LIS3MDL module. Will write the values to
- * the pointers.
- * @param x Pointer to the X value
- * @param y Pointer to the Y value
- * @param z Pointer to the Z value
+ * Read the raw X, Y, and Z output counts from the LIS3MDL module.
+ * @param x Reference to the X value
+ * @param y Reference to the Y value
+ * @param z Reference to the Z value
  */
-std::optional<SimpleSlam::LIS3MDL::error_t> SimpleSlam::LIS3MDL::ReadXYZ(
+std::optional<SimpleSlam::LIS3MDL::error_t> SimpleSlam::LIS3MDL::ReadXYZ_Raw(
     int16_t& x, int16_t& y, int16_t& z) {
-    //    printf("LIS3MDL::ReadXYZ\n");
-
-    // The addresses are consecutive, so we can read 6 bytes in one go
-    // This chip uses low and high registers, so we need to do shifting
-    // we cast the buffer to a uint8_t so buffer stores high low for each axis
-    uint16_t buffer[3];
-    HAL_StatusTypeDef status =
-        I2C_Mem_Read(LIS3MDL_I2C_DEVICE_ADDRESS, REG_X_L, I2C_MEMADD_SIZE_8BIT,
-                     (uint8_t*)&buffer[0], 6);
+    // The addresses are consecutive, so we can read 6 bytes in one go as
+    // long as the sub-address auto-increments.
+    uint8_t buffer[6];
+    HAL_StatusTypeDef status = I2C_Mem_Read(
+        LIS3MDL_I2C_DEVICE_ADDRESS, REG_X_L | LIS3MDL_AUTO_INCREMENT,
+        I2C_MEMADD_SIZE_8BIT, buffer, sizeof(buffer));
     RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Error reading XYZ");
 
-    // we use 16 bit buffers, but pass as 8 bit to the I2C functions
-    // they automatically grab the low and high registers in the right order
-    x = buffer[0];
-    y = buffer[1];
-    z = buffer[2];
+    decode_xyz(buffer, x, y, z);
+    return {};
+}
 
-    // Read the control register 2 to get the sensitivity
-    uint8_t reg2Value = 0;
-    status =
-        I2C_Mem_Read_Single(LIS3MDL_I2C_DEVICE_ADDRESS, REG_CTRL_2, &reg2Value);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR,
-                            "Error reading control register 2");
-
-    // Now we handle the sensitivity
-    // Note: The sensitivity is in milligauss
-    int filter;
-    switch ((reg2Value >> 5) & 0x03) {
-        case 0:
-            filter = SENSITIVITY_4G;
-            break;
-        case 1:
-            filter = SENSITIVITY_8G;
-            break;
-        case 2:
-            filter = SENSITIVITY_12G;
-            break;
-        case 3:
-            filter = SENSITIVITY_16G;
-            break;
-        default:
-            return std::make_optional(std::make_pair(
-                ErrorCode::I2C_ERROR, "Invalid sensitivity value"));
+/**
+ * Read the X, Y, and Z values from the LIS3MDL module in milligauss.
+ * @param x Reference to the X value
+ * @param y Reference to the Y value
+ * @param z Reference to the Z value
+ */
+std::optional<SimpleSlam::LIS3MDL::error_t> SimpleSlam::LIS3MDL::ReadXYZ(
+    int16_t& x, int16_t& y, int16_t& z) {
+    auto maybe_error = ReadXYZ_Raw(x, y, z);
+    RETURN_IF_CONTAINS_ERROR(maybe_error);
+
+    scale_to_milligauss(x, y, z);
+    return {};
+}
+
+HAL_StatusTypeDef SimpleSlam::LIS3MDL::Submit_Read_XYZ(
+    mbed::Callback<void()> on_complete) {
+    core_util_critical_section_enter();
+    if (xyz_read_pending) {
+        core_util_critical_section_exit();
+        return HAL_BUSY;
     }
+    xyz_read_pending = true;
+    core_util_critical_section_exit();
 
-    // The data sheet uses LSB/gauss, but we want mGauss
-    // Divide the raw value by the sensitivity for gauss, then multiply by 1000
-    // for mGauss
-    // TODO: Someone verify this math
-    double sensitivity = 1000.0 / filter;
-    x *= sensitivity;
-    y *= sensitivity;
-    z *= sensitivity;
+    xyz_read_complete = on_complete;
+    HAL_StatusTypeDef status = I2C_Async_Submit(&xyz_transaction);
+    if (status != HAL_OK) {
+        xyz_read_pending = false;
+    }
+    return status;
+}
+
+std::optional<SimpleSlam::LIS3MDL::error_t> SimpleSlam::LIS3MDL::Get_XYZ(
+    int16_t& x, int16_t& y, int16_t& z) {
+    if (!xyz_read_pending || !xyz_transaction.done) {
+        return std::make_optional(std::make_pair(
+            ErrorCode::I2C_ERROR, std::string("No XYZ read to collect")));
+    }
+    xyz_read_pending = false;
+    RETURN_IF_STATUS_NOT_OK(xyz_transaction.status, ErrorCode::I2C_ERROR,
+                            "Error reading XYZ");
 
+    decode_xyz(xyz_buffer, x, y, z);
+    scale_to_milligauss(x, y, z);
     return {};
 }
 
+uint16_t SimpleSlam::LIS3MDL::Get_Sensitivity() {
+    return sensitivity;
+}
+
 /**
  * Deinitialize the LIS3MDL module
  */
@@ -1,9 +1,207 @@
+#include <algorithm>
+
 #include "driver/lsm6dsl.h"
 #include "driver/i2c.h"
+#include "driver/i2c_async.h"
 #include "mbed.h"
 
 using namespace SimpleSlam;
 
+static uint32_t fifo_sample_period_us = 0;
+
+// Sample period of each FIFO_ODR_* setting (12.5Hz ... 6.66kHz), indexed by
+// the ODR field. The rates are not exact doublings, 208Hz is really 4808us.
+// Index 0 turns the FIFO off and has no period.
+// Reference: LSM6DSL data sheet pg. 57, FIFO_CTRL5 ODR_FIFO
+static const uint32_t fifo_odr_period_us[] = {
+    0, 80000, 38462, 19231, 9615, 4808, 2404, 1200, 600, 300, 150,
+};
+#define FIFO_ODR_COUNT (sizeof(fifo_odr_period_us) / sizeof(fifo_odr_period_us[0]))
+
+// Sample clock. The FIFO holds no timestamps with this pattern, so each
+// sample's time comes from its index in the stream and a period tracked
+// across drains, not from when its drain happened to run.
+// Share of each drain's timing error folded into the phase and the period
+#define SAMPLE_CLOCK_PHASE_GAIN 0.1f
+#define SAMPLE_CLOCK_PERIOD_GAIN 0.01f
+// Errors beyond this many periods mean samples were lost, start over
+#define SAMPLE_CLOCK_MAX_ERROR_PERIODS 4
+// The period is trusted to within this fraction of nominal
+#define SAMPLE_CLOCK_MAX_PERIOD_ERROR 0.05f
+static uint32_t drained_samples = 0;     // Samples read since FIFO_Init
+static bool sample_clock_locked = false;
+static uint32_t sample_clock_index = 0;  // Sample the clock was last fixed to
+static uint32_t sample_clock_time_us = 0;
+static float sample_clock_period_us = 0;
+
+static void on_fifo_status_read(i2c_transaction_t* transaction);
+static void on_fifo_data_read(i2c_transaction_t* transaction);
+
+// Async FIFO drain, owned by the driver until FIFO_Get_Batch collects it.
+// Extra words cover realigning to the start of a gyro + accel pattern.
+static uint8_t async_fifo_status[FIFO_STATUS_SIZE];
+static int16_t async_fifo_buffer[(FIFO_MAX_BATCH_SIZE + 1) * FIFO_WORDS_PER_SAMPLE];
+static uint16_t async_skip_words = 0;
+static size_t async_batch_size = 0;
+static size_t async_available = 0;
+static uint32_t async_status_time_us = 0;
+static volatile HAL_StatusTypeDef async_batch_status = HAL_OK;
+static mbed::Callback<void()> batch_read_complete;
+static volatile bool batch_read_pending = false;
+static volatile bool batch_read_done = false;
+static i2c_transaction_t fifo_status_transaction{
+    .type = I2CTransactionType::READ,
+    .peripheral_address = I2C_ADDRESS,
+    .reg_address = FIFO_STATUS_1_REG,
+    .reg_address_size = 1,
+    .buffer = async_fifo_status,
+    .size = FIFO_STATUS_SIZE,
+    .on_complete = on_fifo_status_read,
+    .flags = nullptr,
+    .flag_mask = 0,
+};
+static i2c_transaction_t fifo_data_transaction{
+    .type = I2CTransactionType::READ,
+    .peripheral_address = I2C_ADDRESS,
+    .reg_address = FIFO_DATA_OUT_L_REG,
+    .reg_address_size = 1,
+    .buffer = (uint8_t*)async_fifo_buffer,
+    .size = 0,
+    .on_complete = on_fifo_data_read,
+    .flags = nullptr,
+    .flag_mask = 0,
+};
+
+static uint32_t decimation_factor(uint8_t decimation) {
+    switch (decimation) {
+        case FIFO_DEC_8:
+            return 8;
+        case FIFO_DEC_16:
+            return 16;
+        case FIFO_DEC_32:
+            return 32;
+        default:
+            return decimation;
+    }
+}
+
+/**
+ * Work out how many whole gyro + accel samples can be read from FIFO_STATUS1-4
+ * and how many words to skip to realign on a gyro X first. available is every
+ * whole sample in the FIFO, the batch may be capped below it.
+*/
+static size_t plan_batch(const uint8_t* fifo_status, size_t max_samples, uint16_t& skip_words,
+                         size_t& available) {
+    uint16_t unread_words = fifo_status[0] | ((fifo_status[1] & FIFO_STATUS_2_DIFF_MASK) << 8);
+    uint16_t pattern = fifo_status[2] | ((fifo_status[3] & FIFO_STATUS_4_PATTERN_MASK) << 8);
+
+    // Pattern is the index of the next word to be read, skip to the next gyro X
+    skip_words = pattern == 0 ? 0 : FIFO_WORDS_PER_SAMPLE - pattern;
+    available = 0;
+    if (unread_words < skip_words + FIFO_WORDS_PER_SAMPLE) {
+        return 0;
+    }
+
+    available = (unread_words - skip_words) / FIFO_WORDS_PER_SAMPLE;
+    return std::min(available, std::min(max_samples, (size_t)FIFO_MAX_BATCH_SIZE));
+}
+
+static void reset_sample_clock() {
+    drained_samples = 0;
+    sample_clock_locked = false;
+    sample_clock_period_us = fifo_sample_period_us;
+}
+
+/**
+ * Fix the sample clock to a FIFO status read at status_time_us. The newest of
+ * the available samples was taken within a period before then, so the gap to
+ * the clock's prediction for it is read latency plus any error in the period.
+ * A share of it goes to each, which spreads the latency of a single drain
+ * over many samples instead of landing on the first step of the batch.
+*/
+static void update_sample_clock(size_t available, uint32_t status_time_us) {
+    if (available == 0) {
+        return;
+    }
+    const uint32_t newest = drained_samples + available - 1;
+    const float max_error_us = SAMPLE_CLOCK_MAX_ERROR_PERIODS * (float)fifo_sample_period_us;
+
+    const uint32_t elapsed_samples = newest - sample_clock_index;
+    const float predicted_us = elapsed_samples * sample_clock_period_us;
+    const float error_us = (float)(int32_t)(status_time_us - sample_clock_time_us) - predicted_us;
+    if (!sample_clock_locked || error_us > max_error_us || error_us < -max_error_us) {
+        // First drain, or the FIFO overran and the count no longer matches
+        sample_clock_locked = true;
+        sample_clock_index = newest;
+        sample_clock_time_us = status_time_us;
+        sample_clock_period_us = fifo_sample_period_us;
+        return;
+    }
+    if (elapsed_samples == 0) {
+        return;
+    }
+
+    const float max_period_error_us = SAMPLE_CLOCK_MAX_PERIOD_ERROR * fifo_sample_period_us;
+    sample_clock_period_us = std::clamp(
+        sample_clock_period_us + SAMPLE_CLOCK_PERIOD_GAIN * error_us / elapsed_samples,
+        fifo_sample_period_us - max_period_error_us,
+        fifo_sample_period_us + max_period_error_us);
+    sample_clock_index = newest;
+    sample_clock_time_us += (int32_t)(predicted_us + SAMPLE_CLOCK_PHASE_GAIN * error_us + 0.5f);
+}
+
+/**
+ * Apply sensitivities and timestamp each sample off the sample clock
+*/
+static void decode_batch(const int16_t* buffer, size_t batch_size,
+                         SimpleSlam::LSM6DSL::imu_sample_t* samples) {
+    for (size_t i = 0; i < batch_size; i++) {
+        const int16_t* words = &buffer[i * FIFO_WORDS_PER_SAMPLE];
+        for (int axis = 0; axis < 3; axis++) {
+            samples[i].gyro[axis] = (int16_t)(words[axis] * GYRO_SENSITIVITY);
+            samples[i].accel[axis] = (int16_t)(words[axis + 3] * ACCEL_SENSITIVITY);
+        }
+        const uint32_t samples_before_fix = sample_clock_index - (drained_samples + i);
+        samples[i].timestamp_us =
+            sample_clock_time_us - (uint32_t)(samples_before_fix * sample_clock_period_us + 0.5f);
+    }
+    drained_samples += batch_size;
+}
+
+static void finish_batch_read(HAL_StatusTypeDef status) {
+    async_batch_status = status;
+    batch_read_done = true;
+    if (batch_read_complete) {
+        batch_read_complete();
+    }
+}
+
+static void on_fifo_status_read(i2c_transaction_t* transaction) {
+    async_status_time_us = us_ticker_read();
+    if (transaction->status != HAL_OK) {
+        finish_batch_read(transaction->status);
+        return;
+    }
+
+    async_batch_size = plan_batch(async_fifo_status, FIFO_MAX_BATCH_SIZE, async_skip_words,
+                                  async_available);
+    if (async_batch_size == 0) {
+        finish_batch_read(HAL_OK);
+        return;
+    }
+
+    // FIFO_DATA_OUT_H wraps back to FIFO_DATA_OUT_L during multi-byte reads
+    fifo_data_transaction.size = (async_skip_words + async_batch_size * FIFO_WORDS_PER_SAMPLE) * 2;
+    HAL_StatusTypeDef status = I2C_Async_Submit(&fifo_data_transaction);
+    if (status != HAL_OK) {
+        finish_batch_read(status);
+    }
+}
+
+static void on_fifo_data_read(i2c_transaction_t* transaction) {
+    finish_batch_read(transaction->status);
+}
+
 std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::Accel_Init() {
     // Wait for peripheral to turn on
     HAL_StatusTypeDef status;
@@ -168,4 +366,189 @@ std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::Gyro_Read(int16
     }
 
     return {};
-}
\ No newline at end of file
+}
+
+std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::IMU_Read_Raw(uint8_t* buffer) {
+    HAL_StatusTypeDef status = I2C_Mem_Read(
+        I2C_ADDRESS,
+        IMU_READ_REG_START,
+        1,
+        buffer,
+        IMU_BUFFER_SIZE
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to Read IMU Data");
+    return {};
+}
+
+std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::Read_IMU(imu_sample_t& sample) {
+    int16_t buffer[IMU_BUFFER_SIZE / 2];
+    auto maybe_error = IMU_Read_Raw((uint8_t*)buffer);
+    RETURN_IF_CONTAINS_ERROR(maybe_error);
+    sample.timestamp_us = us_ticker_read();
+
+    for (int i = 0; i < 3; i++) {
+        sample.gyro[i] = (int16_t)(buffer[i] * GYRO_SENSITIVITY);
+        sample.accel[i] = (int16_t)(buffer[i + 3] * ACCEL_SENSITIVITY);
+    }
+    return {};
+}
+
+std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::FIFO_Init(const fifo_config_t& config) {
+    // An ODR of 0 turns the FIFO off and FIFO_DEC_NOT_IN_FIFO leaves the
+    // samples out of it, neither streams anything
+    const uint8_t odr_index = (config.odr & FIFO_ODR_MASK) >> 3;
+    if (odr_index == 0 || odr_index >= FIFO_ODR_COUNT ||
+        config.decimation == FIFO_DEC_NOT_IN_FIFO || config.decimation > FIFO_DEC_32) {
+        return std::make_optional(std::make_pair(
+            ErrorCode::INVALID_CONFIG, std::string("Invalid FIFO ODR or decimation")));
+    }
+
+    HAL_StatusTypeDef status;
+
+    // Watermark is expressed in 16-bit words, FTH[7:0] in CTRL1 and FTH[10:8] in CTRL2
+    uint16_t threshold_words = config.threshold * FIFO_WORDS_PER_SAMPLE;
+    status = I2C_Mem_Write_Single(
+        I2C_ADDRESS,
+        FIFO_CTRL_1_REG,
+        threshold_words & 0xFF
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to write to FIFO Ctrl 1");
+
+    status = I2C_Mem_Write_Single(
+        I2C_ADDRESS,
+        FIFO_CTRL_2_REG,
+        (threshold_words >> 8) & 0x07
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to write to FIFO Ctrl 2");
+
+    uint8_t fifo_ctrl_3 = (config.decimation << FIFO_GYRO_DEC_SHIFT) | config.decimation;
+    status = I2C_Mem_Write_Single(
+        I2C_ADDRESS,
+        FIFO_CTRL_3_REG,
+        fifo_ctrl_3
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to write to FIFO Ctrl 3");
+
+    // Going through bypass empties the FIFO before streaming starts
+    status = I2C_Mem_Write_Single(
+        I2C_ADDRESS,
+        FIFO_CTRL_5_REG,
+        FIFO_MODE_BYPASS
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to write to FIFO Ctrl 5");
+
+    status = I2C_Mem_Write_Single(
+        I2C_ADDRESS,
+        FIFO_CTRL_5_REG,
+        config.odr | FIFO_MODE_CONTINUOUS
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to write to FIFO Ctrl 5");
+
+    fifo_sample_period_us = fifo_odr_period_us[odr_index] * decimation_factor(config.decimation);
+    reset_sample_clock();
+    return {};
+}
+
+std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::FIFO_DeInit() {
+    HAL_StatusTypeDef status = I2C_Mem_Write_Single(
+        I2C_ADDRESS,
+        FIFO_CTRL_5_REG,
+        FIFO_MODE_BYPASS
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to write to FIFO Ctrl 5");
+    fifo_sample_period_us = 0;
+    reset_sample_clock();
+    return {};
+}
+
+std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::INT1_Init(uint8_t sources) {
+    HAL_StatusTypeDef status = I2C_Mem_Write_Single(
+        I2C_ADDRESS,
+        INT1_CTRL_REG,
+        sources
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to write to INT1 Ctrl");
+    return {};
+}
+
+std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::FIFO_Read_Batch(
+    imu_sample_t* samples, size_t max_samples, size_t& num_samples) {
+    // Extra words cover realigning to the start of a gyro + accel pattern
+    static int16_t buffer[(FIFO_MAX_BATCH_SIZE + 1) * FIFO_WORDS_PER_SAMPLE];
+    num_samples = 0;
+
+    uint8_t fifo_status[FIFO_STATUS_SIZE];
+    HAL_StatusTypeDef status = I2C_Mem_Read(
+        I2C_ADDRESS,
+        FIFO_STATUS_1_REG,
+        1,
+        fifo_status,
+        FIFO_STATUS_SIZE
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to Read FIFO Status");
+    const uint32_t status_time_us = us_ticker_read();
+
+    uint16_t skip_words;
+    size_t available;
+    size_t batch_size = plan_batch(fifo_status, max_samples, skip_words, available);
+    if (batch_size == 0) {
+        return {};
+    }
+
+    // FIFO_DATA_OUT_H wraps back to FIFO_DATA_OUT_L during multi-byte reads.
+    // The burst is the bulk of the bus time, so hand it to DMA.
+    uint16_t read_words = skip_words + batch_size * FIFO_WORDS_PER_SAMPLE;
+    status = I2C_Async_Mem_Read(
+        I2C_ADDRESS,
+        FIFO_DATA_OUT_L_REG,
+        1,
+        (uint8_t*)buffer,
+        read_words * 2
+    );
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, "Failed to Read FIFO Data");
+
+    update_sample_clock(available, status_time_us);
+    decode_batch(&buffer[skip_words], batch_size, samples);
+    num_samples = batch_size;
+    return {};
+}
+
+HAL_StatusTypeDef SimpleSlam::LSM6DSL::FIFO_Submit_Read_Batch(mbed::Callback<void()> on_complete) {
+    core_util_critical_section_enter();
+    if (batch_read_pending) {
+        core_util_critical_section_exit();
+        return HAL_BUSY;
+    }
+    batch_read_pending = true;
+    core_util_critical_section_exit();
+
+    batch_read_done = false;
+    async_batch_size = 0;
+    async_available = 0;
+    batch_read_complete = on_complete;
+    HAL_StatusTypeDef status = I2C_Async_Submit(&fifo_status_transaction);
+    if (status != HAL_OK) {
+        batch_read_pending = false;
+    }
+    return status;
+}
+
+std::optional<SimpleSlam::LSM6DSL::error_t> SimpleSlam::LSM6DSL::FIFO_Get_Batch(
+    imu_sample_t* samples, size_t& num_samples) {
+    num_samples = 0;
+    if (!batch_read_pending || !batch_read_done) {
+        return std::make_optional(std::make_pair(
+            ErrorCode::I2C_ERROR, std::string("No FIFO batch to collect")));
+    }
+    batch_read_pending = false;
+    RETURN_IF_STATUS_NOT_OK(async_batch_status, ErrorCode::I2C_ERROR, "Failed to Read FIFO Data");
+
+    update_sample_clock(async_available, async_status_time_us);
+    decode_batch(&async_fifo_buffer[async_skip_words], async_batch_size, samples);
+    num_samples = async_batch_size;
+    return {};
+}
+
+uint32_t SimpleSlam::LSM6DSL::FIFO_Get_Sample_Period_Us() {
+    return fifo_sample_period_us;
+}
@@ -28,10 +28,12 @@
  * and start seeing some output.
 */
 
+#include <algorithm>
 #include <map>
 #include <vector>
 
 #include "driver/vl53l0x.h"
+#include "driver/i2c_async.h"
 
 
 #define RETURN_IF_CONTAINS_ERROR(maybe_error) if (maybe_error.has_value()) { return maybe_error; }
@@ -63,6 +65,75 @@ std::map<uint8_t, std::vector<uint8_t>> vcsel_final_range_configurations = {
 
 static uint8_t stop_variable;
 
+// Register pre-amble loading stop_variable before a measurement starts,
+// recorded once at Init and replayed by load_stop_variable().
+#define STOP_VARIABLE_SEQUENCE_SIZE 7
+static SimpleSlam::i2c_register_write_t stop_variable_sequence[STOP_VARIABLE_SEQUENCE_SIZE];
+
+static uint32_t last_read_transaction_count = 0;
+
+static void on_range_read(SimpleSlam::i2c_transaction_t* transaction);
+static void on_range_interrupt_cleared(SimpleSlam::i2c_transaction_t* transaction);
+
+// Async range read, owned by the driver until Get_Range collects it. The
+// read chains the interrupt clear from its completion.
+static uint8_t range_buffer[2];
+static uint8_t range_interrupt_clear = 0x01;
+static mbed::Callback<void()> range_read_complete;
+static volatile bool range_read_pending = false;
+static volatile bool range_read_done = false;
+static SimpleSlam::i2c_transaction_t range_transaction{
+    .type = SimpleSlam::I2CTransactionType::READ,
+    .peripheral_address = VL53L0X_I2C_DEVICE_ADDRESS,
+    .reg_address = RESULT_RANGE_STATUS + 10,
+    .reg_address_size = ADDR_SIZE_8,
+    .buffer = range_buffer,
+    .size = sizeof(range_buffer),
+    .on_complete = on_range_read,
+    .flags = nullptr,
+    .flag_mask = 0,
+};
+static SimpleSlam::i2c_transaction_t range_interrupt_clear_transaction{
+    .type = SimpleSlam::I2CTransactionType::WRITE,
+    .peripheral_address = VL53L0X_I2C_DEVICE_ADDRESS,
+    .reg_address = SYSTEM_INTERRUPT_CLEAR,
+    .reg_address_size = ADDR_SIZE_8,
+    .buffer = &range_interrupt_clear,
+    .size = SINGLE_SIZE,
+    .on_complete = on_range_interrupt_cleared,
+    .flags = nullptr,
+    .flag_mask = 0,
+};
+
+static void finish_range_read() {
+    range_read_done = true;
+    if (range_read_complete) {
+        range_read_complete();
+    }
+}
+
+static void on_range_read(SimpleSlam::i2c_transaction_t* transaction) {
+    range_interrupt_clear_transaction.status = HAL_ERROR;
+    if (transaction->status != HAL_OK ||
+        SimpleSlam::I2C_Async_Submit(&range_interrupt_clear_transaction) != HAL_OK) {
+        finish_range_read();
+    }
+}
+
+static void on_range_interrupt_cleared(SimpleSlam::i2c_transaction_t* transaction) {
+    finish_range_read();
+}
+
+// Range is stored hi byte first. The value will become 8190 if there is no
+// obstacle in its path, so set to 0 as we are not "seeing" anything.
+static uint16_t decode_range(const uint8_t* buffer) {
+    uint16_t range = ((uint16_t)buffer[0] << 8) | buffer[1];
+    if (range == 8190 || range == 8191) {
+        range = 0;
+    }
+    return range;
+}
+
 std::optional<SimpleSlam::VL53L0X::error_t> 
 SimpleSlam::VL53L0X::Init(const VL53L0X_Config_t& config) {
     printf("[VL53L0X]: Performing Software Reset on Sensor\n");
@@ -72,6 +143,7 @@ SimpleSlam::VL53L0X::Init(const VL53L0X_Config_t& config) {
     printf("[VL53L0X]: Initializing Data\n");
     maybe_error = data_init(config);
     RETURN_IF_CONTAINS_ERROR(maybe_error)
+    prepare_stop_variable_sequence();
 
     printf("[VL53L0X]: Performing Static Data Initilization\n");
     maybe_error = static_init(config);
@@ -335,26 +407,32 @@ SimpleSlam::VL53L0X::Set_Vcsel_Pulse_Period(VcselPulsePeriod period, uint8_t pcl
 }
 
 std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Perform_Single_Shot_Read(uint16_t& distance) {
+    uint32_t start_count = I2C_Get_Transaction_Count();
+    auto maybe_error = Start_Single_Shot();
+    RETURN_IF_CONTAINS_ERROR(maybe_error)
+
     HAL_StatusTypeDef status;
+    uint8_t result_ready_val;
+    status = SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_INTERRUPT_STATUS, &result_ready_val);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed while wating for result"))
+    while ((result_ready_val & 0x07) == 0) {
+        status = SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_INTERRUPT_STATUS, &result_ready_val);
+        RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed while wating for result"))
+    }
 
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, POWER_MANAGEMENT_GO1_POWER_FORCE, 0x01);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, INTERNAL_TUNING_x2, 0x01);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, 0x00);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
-    SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, INTERNAL_TUNING_x1, stop_variable);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, 0x01);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, INTERNAL_TUNING_x2, 0x00);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, POWER_MANAGEMENT_GO1_POWER_FORCE, 0x00);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
+    maybe_error = Read_Range_Result(distance);
+    last_read_transaction_count = I2C_Get_Transaction_Count() - start_count;
+    return maybe_error;
+}
+
+std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Start_Single_Shot() {
+    auto maybe_error = load_stop_variable();
+    RETURN_IF_CONTAINS_ERROR(maybe_error)
 
     // Set to single shot mode
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, SYSRANGE_MODE_SINGLESHOT);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Perform_Single_Shot_Read() during measurement setup"))
+    HAL_StatusTypeDef status;
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, SYSRANGE_MODE_SINGLESHOT | SYSRANGE_MODE_START_STOP);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Start_Single_Shot() during measurement setup"))
 
     uint8_t sysrange_start_val;
     status = SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, &sysrange_start_val);
@@ -364,33 +442,131 @@ std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Perform_Single_
         RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed while waiting for sysrange_start reg val to clear"))
     }
 
-    uint8_t result_ready_val;
-    status = SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_INTERRUPT_STATUS, &result_ready_val);
+    return {};
+}
+
+std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Read_Range_Result(uint16_t& distance) {
+    uint32_t start_count = I2C_Get_Transaction_Count();
+    HAL_StatusTypeDef status;
+    uint8_t buffer[2];
+    // Why 10? Range is stored hi byte first at RESULT_RANGE_STATUS + 10
+    status = SimpleSlam::I2C_Mem_Read(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_RANGE_STATUS + 10, ADDR_SIZE_8, buffer, 2);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed reading range result"))
+
+    distance = decode_range(buffer);
+
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSTEM_INTERRUPT_CLEAR, 0x01);
+    last_read_transaction_count = I2C_Get_Transaction_Count() - start_count;
     RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed while wating for result"))
-    while ((result_ready_val & 0x07) == 0) {
-        status = SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_INTERRUPT_STATUS, &result_ready_val);
-        RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed while wating for result"))
+    return {};
+}
+
+std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Start_Continuous(uint32_t period_ms) {
+    auto maybe_error = load_stop_variable();
+    RETURN_IF_CONTAINS_ERROR(maybe_error)
+
+    HAL_StatusTypeDef status;
+    if (period_ms == 0) {
+        status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, SYSRANGE_MODE_BACK_TO_BACK);
+        RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Start_Continuous() writing SYSRANGE_START"))
+        return {};
     }
 
-    uint16_t buffer = 0;
-    // Why 10? Read in hi byte first
-    SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_RANGE_STATUS + 10, (uint8_t*)&buffer);
-    buffer = buffer << 8;
-    SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_RANGE_STATUS + 11, (uint8_t*)&buffer);
+    // The inter-measurement period is counted in oscillator ticks, the
+    // factory calibration gives the number of ticks per ms.
+    // reference: VL53L0X_SetInterMeasurementPeriodMilliSeconds()
+    uint8_t osc_calibrate_val[2];
+    status = SimpleSlam::I2C_Mem_Read(VL53L0X_I2C_DEVICE_ADDRESS, OSC_CALIBRATE_VAL, ADDR_SIZE_8, osc_calibrate_val, 2);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Start_Continuous() reading OSC_CALIBRATE_VAL"))
+
+    uint16_t ticks_per_ms = ((uint16_t)osc_calibrate_val[0] << 8) | osc_calibrate_val[1];
+    uint32_t period = ticks_per_ms != 0 ? period_ms * ticks_per_ms : period_ms;
+
+    uint8_t period_buffer[4] = {
+        (uint8_t)(period >> 24), (uint8_t)(period >> 16),
+        (uint8_t)(period >> 8), (uint8_t)period,
+    };
+    status = SimpleSlam::I2C_Mem_Write(VL53L0X_I2C_DEVICE_ADDRESS, SYSTEM_INTERMEASUREMENT_PERIOD, ADDR_SIZE_8, period_buffer, 4);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Start_Continuous() writing SYSTEM_INTERMEASUREMENT_PERIOD"))
+
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, SYSRANGE_MODE_TIMED);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed in Start_Continuous() writing SYSRANGE_START"))
+    return {};
+}
+
+std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Stop_Continuous() {
+    HAL_StatusTypeDef status;
+    std::string error_msg("Failed I2C in Stop_Continuous()");
+
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, SYSRANGE_MODE_START_STOP);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, error_msg)
+
+    // Undo the stop variable load from Start_Continuous()
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, INTERNAL_TUNING_x2, 0x01);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, error_msg)
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, 0x00);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, error_msg)
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, INTERNAL_TUNING_x1, 0x00);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, error_msg)
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSRANGE_START, 0x01);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, error_msg)
+    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, INTERNAL_TUNING_x2, 0x00);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, error_msg)
+
+    return {};
+}
 
-    // The value will become 8190 if there is no obstacle in its path. So
-    // set to 0 as we are not "seeing" anything.
-    if (buffer == 8190 || buffer == 8191) {
-        buffer = 0;
+std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Try_Read_Range(uint16_t& distance, bool& ready) {
+    HAL_StatusTypeDef status;
+    uint8_t result_ready_val;
+    status = SimpleSlam::I2C_Mem_Read_Single(VL53L0X_I2C_DEVICE_ADDRESS, RESULT_INTERRUPT_STATUS, &result_ready_val);
+    last_read_transaction_count = 1;
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed reading RESULT_INTERRUPT_STATUS"))
+
+    ready = (result_ready_val & 0x07) != 0;
+    if (!ready) {
+        return {};
     }
+    auto maybe_error = Read_Range_Result(distance);
+    last_read_transaction_count += 1;
+    return maybe_error;
+}
 
-    distance = buffer;
+HAL_StatusTypeDef SimpleSlam::VL53L0X::Submit_Read_Range(mbed::Callback<void()> on_complete) {
+    core_util_critical_section_enter();
+    if (range_read_pending) {
+        core_util_critical_section_exit();
+        return HAL_BUSY;
+    }
+    range_read_pending = true;
+    core_util_critical_section_exit();
+
+    range_read_done = false;
+    range_read_complete = on_complete;
+    HAL_StatusTypeDef status = I2C_Async_Submit(&range_transaction);
+    if (status != HAL_OK) {
+        range_read_pending = false;
+    }
+    return status;
+}
 
-    status = SimpleSlam::I2C_Mem_Write_Single(VL53L0X_I2C_DEVICE_ADDRESS, SYSTEM_INTERRUPT_CLEAR, 0x01);
-    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed while wating for result"))
+std::optional<SimpleSlam::VL53L0X::error_t> SimpleSlam::VL53L0X::Get_Range(uint16_t& distance) {
+    if (!range_read_pending || !range_read_done) {
+        return std::make_optional(std::make_pair(ErrorCode::I2C_ERROR, std::string("No range read to collect")));
+    }
+    range_read_pending = false;
+    last_read_transaction_count = 2;
+    RETURN_IF_STATUS_NOT_OK(range_transaction.status, ErrorCode::I2C_ERROR, std::string("Failed reading range result"))
+
+    distance = decode_range(range_buffer);
+    RETURN_IF_STATUS_NOT_OK(range_interrupt_clear_transaction.status, ErrorCode::I2C_ERROR, std::string("Failed while wating for result"))
     return {};
 }
 
+uint32_t SimpleSlam::VL53L0X::Get_Last_Read_Transaction_Count() {
+    return last_read_transaction_count;
+}
+
 std::optional<SimpleSlam::VL53L0X::error_t> 
 SimpleSlam::VL53L0X::data_init(const VL53L0X_Config_t& config) {
     HAL_StatusTypeDef status;
@@ -1090,4 +1266,30 @@ SimpleSlam::VL53L0X::encode_timeout(uint16_t timeout_mclks) {
         return (ms_byte << 8) | (ls_byte & 0xFF);
     }
     return 0;
-}
\ No newline at end of file
+}
+
+void SimpleSlam::VL53L0X::prepare_stop_variable_sequence() {
+    // Has to precede every measurement start.
+    // reference: VL53L0X_StartMeasurement()
+    const i2c_register_write_t sequence[STOP_VARIABLE_SEQUENCE_SIZE] = {
+        {POWER_MANAGEMENT_GO1_POWER_FORCE, 0x01},
+        {INTERNAL_TUNING_x2, 0x01},
+        {SYSRANGE_START, 0x00},
+        {INTERNAL_TUNING_x1, stop_variable},
+        {SYSRANGE_START, 0x01},
+        {INTERNAL_TUNING_x2, 0x00},
+        {POWER_MANAGEMENT_GO1_POWER_FORCE, 0x00},
+    };
+    std::copy(sequence, sequence + STOP_VARIABLE_SEQUENCE_SIZE, stop_variable_sequence);
+}
+
+std::optional<SimpleSlam::VL53L0X::error_t> 
+SimpleSlam::VL53L0X::load_stop_variable() {
+    // The registers are not contiguous so the sequence cannot be a single
+    // burst, but it is only assembled once.
+    HAL_StatusTypeDef status = SimpleSlam::I2C_Write_Sequence(
+        VL53L0X_I2C_DEVICE_ADDRESS, stop_variable_sequence, STOP_VARIABLE_SEQUENCE_SIZE);
+    RETURN_IF_STATUS_NOT_OK(status, ErrorCode::I2C_ERROR, std::string("Failed I2C in load_stop_variable()"))
+
+    return {};
+}
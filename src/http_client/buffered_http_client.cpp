@@ -1,12 +1,38 @@
 #include "http_client/buffered_http_client.h"
 
+#include "data/json_writer.h"
+#include "data/point_batch.h"
+
+#define BOARD_ID "b1"
+
+// {"board_id":"b1","spatials":[],"positions":[]} with room to spare
+#define COLLECT_PAYLOAD_OVERHEAD 64
+// [x,y], plus the separating comma
+#define COLLECT_POINT_LENGTH (2 * SimpleSlam::JSONWriter::MAX_NUMBER_LENGTH + 4)
+// Whole cm matches the ToF resolution, and successive points are close
+// enough that most deltas fit a single varint byte per axis
+#define POINT_BATCH_ENCODING SimpleSlam::PointEncoding::DELTA_VARINT_CM
+
+static size_t payload_capacity(SimpleSlam::PayloadFormat format,
+                               size_t capacity) {
+    if (format == SimpleSlam::PayloadFormat::BINARY) {
+        return SimpleSlam::PointBatchWriter::Max_Size(
+            strlen(BOARD_ID), capacity, POINT_BATCH_ENCODING);
+    }
+    return COLLECT_PAYLOAD_OVERHEAD + 2 * capacity * COLLECT_POINT_LENGTH;
+}
+
 SimpleSlam::BufferedHTTPClient::BufferedHTTPClient(
-    SimpleSlam::HttpClient& http_client, size_t capacity, std::string host)
+    SimpleSlam::HttpClient& http_client, size_t capacity, std::string host,
+    PayloadFormat format)
     : _http_client(std::move(http_client)),
       _capacity(capacity),
       _mutex(),
       _cond_var(_mutex),
-      _host(std::move(host)) {}
+      _host(std::move(host)),
+      _format(format),
+      _payload_capacity(payload_capacity(format, capacity)),
+      _payload(std::make_unique<char[]>(_payload_capacity)) {}
 
 void SimpleSlam::BufferedHTTPClient::begin_processing() {
     std::optional<HttpClient::error_t> maybe_error = _http_client.init();
@@ -15,7 +41,7 @@ void SimpleSlam::BufferedHTTPClient::begin_processing() {
                maybe_error.value().second.c_str());
     }
 
-    _http_client.delete_request(_host, "/api/reset/b1");
+    _http_client.delete_request(_host, "/api/reset/" BOARD_ID);
 
     while (true) {
         _mutex.lock();
@@ -23,28 +49,28 @@ void SimpleSlam::BufferedHTTPClient::begin_processing() {
             _cond_var.wait();
         }
 
-        std::vector<std::any> spatials;
-        std::vector<std::any> positions;
-        for (auto& data_point : _buffered_data) {
-            spatials.push_back(
-                std::vector<std::any>{data_point.spatial_point.get_x(),
-                                      data_point.spatial_point.get_y()});
-            positions.push_back(
-                std::vector<std::any>{data_point.position_point.get_x(),
-                                      data_point.position_point.get_y()});
-        }
+        const size_t payload_size = _format == PayloadFormat::BINARY
+                                        ? serialize_binary()
+                                        : serialize_json();
         _buffered_data.clear();
         _mutex.unlock();
-        JSON data;
-
-        data.add("board_id", "b1")
-            .add("spatials", spatials)
-            .add("positions", positions);
 
-        printf("Data being sent: %s\n", data.build().c_str());
+        if (payload_size == 0) {
+            printf("Buffered HTTP Client payload overflowed\n");
+            continue;
+        }
 
-        std::optional<HttpClient::error_t> maybe_error =
-            _http_client.post_request(_host, "/api/collect", data);
+        std::optional<HttpClient::error_t> maybe_error;
+        if (_format == PayloadFormat::BINARY) {
+            printf("Sending %u byte point batch\n", (unsigned)payload_size);
+            maybe_error = _http_client.post_request(
+                _host, "/api/collect", _payload.get(), payload_size,
+                "application/octet-stream");
+        } else {
+            printf("Data being sent: %s\n", _payload.get());
+            maybe_error = _http_client.post_request(
+                _host, "/api/collect", _payload.get(), payload_size);
+        }
 
         if (maybe_error.has_value()) {
             printf("Encountered Error in Buffered HTTP Client: %s\n",
@@ -53,6 +79,42 @@ void SimpleSlam::BufferedHTTPClient::begin_processing() {
     }
 }
 
+/**
+ * @return Length of the JSON body in _payload, 0 if it did not fit.
+ */
+size_t SimpleSlam::BufferedHTTPClient::serialize_json() {
+    typedef point_data_t const& point_ref;
+    JSONWriter payload(_payload.get(), _payload_capacity);
+    payload.begin_object()
+        .field("board_id", BOARD_ID)
+        .key("spatials")
+        .array(_buffered_data.data(), _buffered_data.size(),
+               [](point_ref point) { return point.spatial_point; })
+        .key("positions")
+        .array(_buffered_data.data(), _buffered_data.size(),
+               [](point_ref point) { return point.position_point; })
+        .end_object();
+    return payload.ok() ? payload.size() : 0;
+}
+
+/**
+ * @return Length of the point batch in _payload, 0 if it did not fit.
+ */
+size_t SimpleSlam::BufferedHTTPClient::serialize_binary() {
+    const uint32_t timestamp_ms =
+        Kernel::Clock::now().time_since_epoch().count();
+    PointBatchWriter payload((uint8_t*)_payload.get(), _payload_capacity,
+                             POINT_BATCH_ENCODING);
+    payload.header(BOARD_ID, timestamp_ms, _buffered_data.size());
+    for (auto& data_point : _buffered_data) {
+        payload.point(data_point.spatial_point);
+    }
+    for (auto& data_point : _buffered_data) {
+        payload.point(data_point.position_point);
+    }
+    return payload.ok() ? payload.size() : 0;
+}
+
 void SimpleSlam::BufferedHTTPClient::add_data(point_data_t const& data) {
     _mutex.lock();
     if (_buffered_data.size() < _capacity) {
@@ -1,6 +1,10 @@
 #include "http_client/http_client.h"
 
 #include <optional>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
 #include <string>
 #include <utility>
 
@@ -14,9 +18,26 @@ using namespace SimpleSlam;
 
 SimpleSlam::HttpClient::HttpClient(unique_ptr<WiFiInterface> wifi,
                                    int port = 80)
-    : _wifi(std::move(wifi)), _port(port) {}
+    : _wifi(std::move(wifi)),
+      _port(port),
+      _keep_alive(false),
+      _idle_timeout(0),
+      _connected(false),
+      _response(std::make_unique<char[]>(RESPONSE_SIZE)),
+      _dns_cache(),
+      _dns_hits(0),
+      _dns_misses(0) {}
 
-SimpleSlam::HttpClient::HttpClient(HttpClient&& other) : _wifi(std::move(other._wifi)), _port(other._port) {}
+SimpleSlam::HttpClient::HttpClient(HttpClient&& other)
+    : _wifi(std::move(other._wifi)),
+      _port(other._port),
+      _keep_alive(other._keep_alive),
+      _idle_timeout(other._idle_timeout),
+      _connected(false),
+      _response(std::move(other._response)),
+      _dns_cache(other._dns_cache),
+      _dns_hits(other._dns_hits),
+      _dns_misses(other._dns_misses) {}
 
 std::optional<HttpClient::error_t> HttpClient::init() {
     printf("[HttpClient]: Http Client Init\n");
@@ -30,35 +51,42 @@ std::optional<HttpClient::error_t> HttpClient::init() {
     return {};
 }
 
+void HttpClient::set_keep_alive(bool keep_alive,
+                                std::chrono::milliseconds idle_timeout) {
+    _keep_alive = keep_alive;
+    _idle_timeout = idle_timeout;
+    if (!_keep_alive) {
+        disconnect();
+    }
+}
+
+uint32_t HttpClient::dns_cache_hits() const { return _dns_hits; }
+
+uint32_t HttpClient::dns_cache_misses() const { return _dns_misses; }
+
 std::optional<HttpClient::error_t> HttpClient::post_request(
     std::string host, std::string endpoint, JSON body_json) {
+    string body = body_json.build();
+    return post_request(std::move(host), std::move(endpoint), body.c_str(),
+                        body.length());
+}
+
+std::optional<HttpClient::error_t> HttpClient::post_request(
+    std::string host, std::string endpoint, const char* body,
+    size_t body_length, const char* content_type) {
     SimpleSlam::Header header;
     string request;
-    string body = body_json.build();
     header.request_type(SimpleSlam::HTTPRequestType::POST, endpoint)
         .add("Host", host)
-        .add("Content-Type", "application/json")
-        .add("Content-Length", std::to_string(body.length()));
+        .add("Connection", _keep_alive ? "keep-alive" : "close")
+        .add("Content-Type", content_type)
+        .add("Content-Length", std::to_string(body_length));
 
     std::string header_str = header.build();
-    request.append(header_str).append("\r\n").append(body);
+    request.reserve(header_str.length() + 2 + body_length);
+    request.append(header_str).append("\r\n").append(body, body_length);
 
-    _wifi->gethostbyname(host.c_str(), &_addr);
-    _addr.set_port(_port);
-    _socket.open(_wifi.get());
-    _socket.connect(_addr);
-    _socket.send(request.c_str(), request.length());
-
-    char buffer[16];
-    _socket.recv(buffer, 16);
-    if (strncmp(buffer, "HTTP/1.1 200 OK", 15) != 0) {
-        printf("POST Response: %s\n", buffer);
-        _socket.close();
-        return std::make_optional(std::make_pair(
-            ErrorCode::POST_NOT_OK, error_message(ErrorCode::POST_NOT_OK)));
-    }
-    _socket.close();
-    return {};
+    return send_request(host, request, ErrorCode::POST_NOT_OK);
 }
 
 std::optional<HttpClient::error_t> HttpClient::get_request(
@@ -66,27 +94,13 @@ std::optional<HttpClient::error_t> HttpClient::get_request(
     SimpleSlam::Header header;
     string request;
     header.request_type(SimpleSlam::HTTPRequestType::GET, endpoint)
-        .add("Host", host);
+        .add("Host", host)
+        .add("Connection", _keep_alive ? "keep-alive" : "close");
 
     std::string header_str = header.build();
     request.append(header_str).append("\r\n");
 
-    _wifi->gethostbyname(host.c_str(), &_addr);
-    _addr.set_port(_port);
-    _socket.open(_wifi.get());
-    _socket.connect(_addr);
-    _socket.send(request.c_str(), request.length());
-
-    char buffer[16];
-    _socket.recv(buffer, 16);
-    if (strncmp(buffer, "HTTP/1.1 200 OK", 15) != 0) {
-        printf("GET Response: %s\n", buffer);
-        _socket.close();
-        return std::make_optional(std::make_pair(
-            ErrorCode::GET_NOT_OK, error_message(ErrorCode::GET_NOT_OK)));
-    }
-    _socket.close();
-    return {};
+    return send_request(host, request, ErrorCode::GET_NOT_OK);
 }
 
 std::optional<HttpClient::error_t> HttpClient::delete_request(
@@ -94,27 +108,247 @@ std::optional<HttpClient::error_t> HttpClient::delete_request(
     SimpleSlam::Header header;
     string request;
     header.request_type(SimpleSlam::HTTPRequestType::DELETE, endpoint)
-        .add("Host", host);
+        .add("Host", host)
+        .add("Connection", _keep_alive ? "keep-alive" : "close");
 
     std::string header_str = header.build();
     request.append(header_str).append("\r\n");
 
-    _wifi->gethostbyname(host.c_str(), &_addr);
+    return send_request(host, request, ErrorCode::DELETE_NOT_OK);
+}
+
+/**
+ * Errors meaning the peer had already closed the connection, as opposed to
+ * a timeout where the request may still be in flight. 0 is an orderly close.
+ */
+static bool is_connection_closed(nsapi_size_or_error_t result) {
+    return result == 0 || result == NSAPI_ERROR_NO_CONNECTION ||
+           result == NSAPI_ERROR_CONNECTION_LOST ||
+           result == NSAPI_ERROR_NO_SOCKET;
+}
+
+/**
+ * Send one request and read its response, reusing the open connection when
+ * keep-alive is on. The server may have closed a reused connection since
+ * the last request. If the send fails, or the connection closes before any
+ * response byte, the server cannot have handled the request and it is sent
+ * once more on a fresh connection. Anything else, a timeout in particular,
+ * is reported as is, /api/collect appends and must not see a POST twice.
+ */
+std::optional<HttpClient::error_t> HttpClient::send_request(
+    const std::string& host, const std::string& request, ErrorCode error) {
+    std::optional<response_t> response;
+    for (int attempt = 0; attempt < 2; attempt++) {
+        bool reused = false;
+        if (!connect(host, reused)) {
+            break;
+        }
+        bool closed_by_peer = false;
+        if (send_all(request.c_str(), request.length(), closed_by_peer)) {
+            response = read_response(closed_by_peer);
+        }
+        if (response.has_value()) {
+            break;
+        }
+        disconnect();
+        if (!reused || !closed_by_peer) {
+            break;
+        }
+    }
+
+    if (!response.has_value() || !_keep_alive || !response->keep_alive) {
+        disconnect();
+    } else {
+        _last_used = Kernel::Clock::now();
+    }
+
+    if (!response.has_value() || response->status != 200) {
+        printf("[HttpClient]: Response status %d\n",
+               response.has_value() ? response->status : -1);
+        return std::make_optional(std::make_pair(error, error_message(error)));
+    }
+    return {};
+}
+
+/**
+ * Make sure the socket is connected to host, closing a connection to a
+ * different host or one that has sat idle past the idle timeout first.
+ * reused is set when an already open connection is kept.
+ */
+bool HttpClient::connect(const std::string& host, bool& reused) {
+    if (_connected && (_connected_host != host ||
+                       Kernel::Clock::now() - _last_used > _idle_timeout)) {
+        disconnect();
+    }
+    reused = _connected;
+    if (_connected) {
+        return true;
+    }
+
+    if (!resolve(host, &_addr)) {
+        return false;
+    }
     _addr.set_port(_port);
-    _socket.open(_wifi.get());
-    _socket.connect(_addr);
-    _socket.send(request.c_str(), request.length());
-
-    char buffer[16];
-    _socket.recv(buffer, 16);
-    if (strncmp(buffer, "HTTP/1.1 200 OK", 15) != 0) {
-        printf("DELETE Response: %s\n", buffer);
+    if (_socket.open(_wifi.get()) != NSAPI_ERROR_OK) {
+        return false;
+    }
+    _socket.set_timeout(_SOCKET_TIMEOUT_MS);
+    if (_socket.connect(_addr) != NSAPI_ERROR_OK) {
         _socket.close();
-        return std::make_optional(std::make_pair(
-            ErrorCode::DELETE_NOT_OK, error_message(ErrorCode::DELETE_NOT_OK)));
+        // The host may have moved, look it up again next time
+        forget(host);
+        return false;
     }
-    _socket.close();
-    return {};
+    _connected = true;
+    _connected_host = host;
+    return true;
+}
+
+/**
+ * Address of host from an IP literal, the cache, or gethostbyname in that
+ * order. A lookup replaces an expired entry, or the one closest to expiry.
+ */
+bool HttpClient::resolve(const std::string& host, SocketAddress* address) {
+    if (address->set_ip_address(host.c_str())) {
+        _dns_hits++;
+        return true;
+    }
+
+    const Kernel::Clock::time_point now = Kernel::Clock::now();
+    dns_entry_t* oldest = &_dns_cache[0];
+    for (auto& entry : _dns_cache) {
+        if (entry.host == host && now < entry.expires) {
+            *address = entry.address;
+            _dns_hits++;
+            return true;
+        }
+        if (entry.expires < oldest->expires) {
+            oldest = &entry;
+        }
+    }
+
+    _dns_misses++;
+    if (_wifi->gethostbyname(host.c_str(), address) != NSAPI_ERROR_OK) {
+        return false;
+    }
+    forget(host);
+    oldest->host = host;
+    oldest->address = *address;
+    oldest->expires = now + _DNS_TTL;
+    return true;
+}
+
+void HttpClient::forget(const std::string& host) {
+    for (auto& entry : _dns_cache) {
+        if (entry.host == host) {
+            entry = dns_entry_t();
+        }
+    }
+}
+
+void HttpClient::disconnect() {
+    if (_connected) {
+        _socket.close();
+        _connected = false;
+    }
+}
+
+bool HttpClient::send_all(const char* data, size_t length,
+                          bool& closed_by_peer) {
+    while (length > 0) {
+        nsapi_size_or_error_t sent = _socket.send(data, length);
+        if (sent <= 0) {
+            closed_by_peer = is_connection_closed(sent);
+            return false;
+        }
+        data += sent;
+        length -= sent;
+    }
+    return true;
+}
+
+/**
+ * Value of a header in a NUL terminated header block, matched case
+ * insensitively. nullptr if the header is missing.
+ */
+static const char* find_header(const char* headers, const char* name) {
+    const size_t name_length = strlen(name);
+    for (const char* line = strstr(headers, "\r\n"); line != nullptr;
+         line = strstr(line, "\r\n")) {
+        line += 2;
+        if (strncasecmp(line, name, name_length) == 0 &&
+            line[name_length] == ':') {
+            const char* value = line + name_length + 1;
+            while (*value == ' ') {
+                value++;
+            }
+            return value;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Read the status line and headers, then drain the body so the connection
+ * is left at the start of the next response. Without a Content-Length the
+ * end of the body is unknown and the connection cannot be reused.
+ */
+std::optional<HttpClient::response_t> HttpClient::read_response(
+    bool& closed_by_peer) {
+    char* buffer = _response.get();
+    size_t length = 0;
+    char* header_end = nullptr;
+    while (header_end == nullptr) {
+        if (length + 1 >= RESPONSE_SIZE) {
+            return {};
+        }
+        nsapi_size_or_error_t received =
+            _socket.recv(buffer + length, RESPONSE_SIZE - 1 - length);
+        if (received <= 0) {
+            // Once part of a response is in, the request was handled
+            closed_by_peer = length == 0 && is_connection_closed(received);
+            return {};
+        }
+        length += received;
+        buffer[length] = '\0';
+        header_end = strstr(buffer, "\r\n\r\n");
+    }
+
+    int status = 0;
+    int minor_version = 0;
+    if (sscanf(buffer, "HTTP/1.%d %d", &minor_version, &status) != 2) {
+        return {};
+    }
+
+    // Cut the block after the last header line so the body is not searched
+    header_end[2] = '\0';
+    const size_t body_start = header_end + 4 - buffer;
+    const char* connection = find_header(buffer, "Connection");
+    const char* content_length = find_header(buffer, "Content-Length");
+
+    response_t response{.status = status,
+                        .keep_alive = minor_version >= 1 &&
+                                      content_length != nullptr};
+    if (connection != nullptr && strncasecmp(connection, "close", 5) == 0) {
+        response.keep_alive = false;
+    }
+    if (!response.keep_alive) {
+        return response;
+    }
+
+    const size_t body_length = strtoul(content_length, nullptr, 10);
+    size_t body_received = length - body_start;
+    while (body_received < body_length) {
+        const size_t remaining = body_length - body_received;
+        nsapi_size_or_error_t received = _socket.recv(
+            buffer, remaining < RESPONSE_SIZE ? remaining : RESPONSE_SIZE);
+        if (received <= 0) {
+            response.keep_alive = false;
+            break;
+        }
+        body_received += received;
+    }
+    return response;
 }
 
 std::string HttpClient::error_message(ErrorCode error) {
@@ -4,7 +4,9 @@
 #include "car.h"
 #include "data/header.h"
 #include "data/json.h"
+#include "data/snapshot.h"
 #include "driver/i2c.h"
+#include "driver/i2c_async.h"
 #include "driver/lis3mdl.h"
 #include "driver/lsm6dsl.h"
 #include "driver/vl53l0x.h"
@@ -14,6 +16,7 @@
 #include "math/conversion.h"
 #include "math/inertial_navigation.h"
 #include "math/quaternion.h"
+#include "math/sample_block.h"
 #include "mbed.h"
 #include "http_client/wifi_config.h"
 
@@ -28,61 +31,146 @@ SimpleSlam::calibration_data_t calibration_data{
 InterruptIn calibration_button(BUTTON1);
 DigitalOut calibration_indicator_led(LED1);
 
+// Sensor data-ready lines
+// Reference: UM2153 Appendix A STM32L4 Discovery kit for IoT node I/O assignment
+InterruptIn imu_data_ready(PD_11);    // LSM6DSL INT1, FIFO threshold
+InterruptIn magno_data_ready(PC_8);   // LIS3MDL DRDY
+InterruptIn tof_data_ready(PC_7);     // VL53L0X GPIO1, active low
+
 EventQueue calibration_event_queue;
 EventQueue sensor_event_queue;
 
+// Latest sensor readings. Only published from sensor_event_queue, so any
+// task can read them without going back to the bus.
+typedef struct {
+    SimpleSlam::LSM6DSL::imu_sample_t imu;  // mdps, mg
+    int16_t magnetometer[3];                // mgauss
+    uint32_t magnetometer_timestamp_us;
+} sensor_sample_t;
+
+SimpleSlam::Snapshot<sensor_sample_t> latest_sensor_sample;
+
+typedef struct {
+    SimpleSlam::Math::InertialNavigationSystem* inertial_navigation_system;
+    SimpleSlam::BufferedHTTPClient* buffered_http_client;
+    SimpleSlam::CarHardwareInterface* car_interface;
+} spatial_point_args_t;
+
+// Sensor reads are queued on the async I2C engine straight from the
+// data-ready interrupts, so reads from the three sensors run back-to-back on
+// the bus while the CPU runs the INS math. Each completion fires in
+// interrupt context and posts the processing to sensor_event_queue.
+
+void update_magnetometer();
 void update_intertial_navigation_system(
+    SimpleSlam::Math::InertialNavigationSystem* inertial_navigation_system);
+void calculate_spatial_point(spatial_point_args_t* args);
+
+void post_magnetometer_update() {
+    sensor_event_queue.call(update_magnetometer);
+}
+
+void post_intertial_navigation_update(
     SimpleSlam::Math::InertialNavigationSystem* inertial_navigation_system) {
-    int16_t accel_buffer[3];
-    int16_t gyro_buffer[3];
-    int16_t magno_buffer[3];
-
-    SimpleSlam::LSM6DSL::Accel_Read(accel_buffer);
-    SimpleSlam::LSM6DSL::Gyro_Read(gyro_buffer);
-    SimpleSlam::LIS3MDL::ReadXYZ(magno_buffer[0], magno_buffer[1],
-                                 magno_buffer[2]);
-
-    SimpleSlam::Math::Vector3 temp_accel(accel_buffer[0], accel_buffer[1],
-                                         accel_buffer[2]);
-    SimpleSlam::Math::Vector3 temp_ang(gyro_buffer[0], gyro_buffer[1],
-                                       gyro_buffer[2]);
-    SimpleSlam::Math::Vector3 temp_magno(magno_buffer[0], magno_buffer[1],
-                                         magno_buffer[2]);
-
-    SimpleSlam::Math::Vector3 calibrated_magnet =
-        SimpleSlam::Math::Adjust_Magnetometer_Vector(
-            temp_magno, calibration_data.magnetometer_calibration_data)
-            .normalize();
-
-    SimpleSlam::Math::Vector3 t = temp_accel / 1000;
-    SimpleSlam::Math::Vector3 p = (temp_ang * SimpleSlam::Math::pi / 180000);
-    inertial_navigation_system->add_sample((temp_accel / 1000) * 9.8);
-    inertial_navigation_system->update_position(p, t, calibrated_magnet);
+    sensor_event_queue.call(update_intertial_navigation_system,
+                            inertial_navigation_system);
+}
+
+void post_spatial_point(spatial_point_args_t* args) {
+    sensor_event_queue.call(calculate_spatial_point, args);
+}
+
+// A read still waiting to be collected turns the edge into a no-op, the
+// handler checks the line again once it is done.
+void start_magnetometer_read() {
+    SimpleSlam::LIS3MDL::Submit_Read_XYZ(post_magnetometer_update);
+}
+
+void start_imu_read(
+    SimpleSlam::Math::InertialNavigationSystem* inertial_navigation_system) {
+    SimpleSlam::LSM6DSL::FIFO_Submit_Read_Batch(
+        callback(post_intertial_navigation_update, inertial_navigation_system));
+}
+
+void start_tof_read(spatial_point_args_t* args) {
+    SimpleSlam::VL53L0X::Submit_Read_Range(callback(post_spatial_point, args));
+}
+
+void update_magnetometer() {
+    sensor_sample_t sample = latest_sensor_sample.read();
+    if (!SimpleSlam::LIS3MDL::Get_XYZ(sample.magnetometer[0],
+                                      sample.magnetometer[1],
+                                      sample.magnetometer[2])
+             .has_value()) {
+        sample.magnetometer_timestamp_us = us_ticker_read();
+        latest_sensor_sample.publish(sample);
+    }
+
+    // DRDY is level triggered, a sample landing during the read leaves it
+    // high without producing another edge.
+    if (magno_data_ready.read()) {
+        start_magnetometer_read();
+    }
 }
 
-void calculate_spatial_point(
-    SimpleSlam::Math::InertialNavigationSystem* inertial_navigation_system,
-    SimpleSlam::BufferedHTTPClient* buffered_http_client,
-    SimpleSlam::CarHardwareInterface* car_interface) {
-    int16_t accel_buffer[3];
-    int16_t magno_buffer[3];
+void update_intertial_navigation_system(
+    SimpleSlam::Math::InertialNavigationSystem* inertial_navigation_system) {
+    static SimpleSlam::LSM6DSL::imu_sample_t imu_samples[FIFO_MAX_BATCH_SIZE];
+
+    size_t num_samples = 0;
+    SimpleSlam::LSM6DSL::FIFO_Get_Batch(imu_samples, num_samples);
+    if (num_samples == 0) {
+        if (imu_data_ready.read()) {
+            start_imu_read(inertial_navigation_system);
+        }
+        return;
+    }
 
-    SimpleSlam::LSM6DSL::Accel_Read(accel_buffer);
-    SimpleSlam::LIS3MDL::ReadXYZ(magno_buffer[0], magno_buffer[1],
-                                 magno_buffer[2]);
+    sensor_sample_t sample = latest_sensor_sample.read();
+    sample.imu = imu_samples[num_samples - 1];
+    latest_sensor_sample.publish(sample);
+
+    // Before the first DRDY the magnetometer reads as zero, hold north on x
+    SimpleSlam::Math::Vector3 magno(1, 0, 0);
+    if (sample.magnetometer_timestamp_us != 0) {
+        SimpleSlam::Math::Vector3 temp_magno(sample.magnetometer[0],
+                                             sample.magnetometer[1],
+                                             sample.magnetometer[2]);
+        magno = SimpleSlam::Math::Adjust_Magnetometer_Vector(
+                    temp_magno, calibration_data.magnetometer_calibration_data)
+                    .normalize();
+    }
 
-    SimpleSlam::Math::Vector3 temp_accel(accel_buffer[0], accel_buffer[1],
-                                         accel_buffer[2]);
+    // Convert the whole batch per axis and integrate straight from the blocks
+    static SimpleSlam::Math::SampleBlock<FIFO_MAX_BATCH_SIZE> gyro_block;
+    static SimpleSlam::Math::SampleBlock<FIFO_MAX_BATCH_SIZE> accel_block;
+    static uint32_t imu_timestamps_us[FIFO_MAX_BATCH_SIZE];
+    SimpleSlam::Math::Load_Block(gyro_block, imu_samples,
+                                 &SimpleSlam::LSM6DSL::imu_sample_t::gyro,
+                                 num_samples);
+    SimpleSlam::Math::Load_Block(accel_block, imu_samples,
+                                 &SimpleSlam::LSM6DSL::imu_sample_t::accel,
+                                 num_samples);
+    for (size_t i = 0; i < num_samples; i++) {
+        imu_timestamps_us[i] = imu_samples[i].timestamp_us;
+    }
+    // mdps to rad/s, mg to g
+    SimpleSlam::Math::Scale_Block(gyro_block, SimpleSlam::Math::pi / 180000);
+    SimpleSlam::Math::Scale_Block(accel_block, 1.0f / 1000);
 
-    SimpleSlam::Math::Vector3 temp_magno(magno_buffer[0], magno_buffer[1],
-                                         magno_buffer[2]);
+    inertial_navigation_system->update_batch(gyro_block, accel_block,
+                                             imu_timestamps_us, magno);
 
-    SimpleSlam::Math::Vector3 adjusted_magno(
-        SimpleSlam::Math::Adjust_Magnetometer_Vector(
-            temp_magno, calibration_data.magnetometer_calibration_data));
+    // The FIFO threshold line stays high while a backlog remains, so there
+    // will be no new edge until it is drained.
+    if (imu_data_ready.read()) {
+        start_imu_read(inertial_navigation_system);
+    }
+}
 
+void calculate_spatial_point(spatial_point_args_t* args) {
     uint16_t tof_distance = 0;
-    SimpleSlam::VL53L0X::Perform_Single_Shot_Read(tof_distance);
+    SimpleSlam::VL53L0X::Get_Range(tof_distance);
 
     // Convert ToF distance to cm.
     tof_distance /= 10;
@@ -92,10 +180,16 @@ void calculate_spatial_point(
         return;
     }
 
-    car_interface->check_collision(tof_distance);
+    args->car_interface->check_collision(tof_distance);
 
-    SimpleSlam::Math::Vector3 north_vector(adjusted_magno.normalize());
-    SimpleSlam::Math::Vector3 up_vector(temp_accel.normalize());
+    // Use the orientation the INS has already fused rather than re-reading
+    // the sensors, take the world north and up axes back into the body frame.
+    const SimpleSlam::Math::Quaternion orientation =
+        args->inertial_navigation_system->get_orientation();
+    SimpleSlam::Math::Vector3 north_vector(
+        orientation.rotate_inverse(SimpleSlam::Math::Vector3(1, 0, 0)));
+    SimpleSlam::Math::Vector3 up_vector(
+        orientation.rotate_inverse(SimpleSlam::Math::Vector3(0, 0, 1)));
     SimpleSlam::Math::Vector3 tof_vector(0, 0, 1);
 
     SimpleSlam::Math::Vector2 tof_direction_vector =
@@ -108,11 +202,11 @@ void calculate_spatial_point(
 
     // Convert to cm.
     SimpleSlam::Math::Vector2 position_point =
-        inertial_navigation_system->get_position() * 100;
+        args->inertial_navigation_system->get_position() * 100;
 
     SimpleSlam::Math::Vector2 spatial_point = tof_mapped_point + position_point;
 
-    buffered_http_client->add_data({spatial_point, position_point});
+    args->buffered_http_client->add_data({spatial_point, position_point});
 }
 
 int main() {
@@ -132,7 +226,8 @@ int main() {
     };
 
     // Initialize I2C communication and all the sensors needed.
-    SimpleSlam::I2C_Init();
+    SimpleSlam::I2C_Init(SimpleSlam::I2CSpeed::FAST_400KHZ);
+    SimpleSlam::I2C_Async_Init();
     SimpleSlam::LIS3MDL::Init(magno_config);
     SimpleSlam::VL53L0X::Init(tof_config);
     SimpleSlam::LSM6DSL::Accel_Init();
@@ -147,23 +242,56 @@ int main() {
         .current_calibration_step = &current_calibration_step,
         .indicator_led = &calibration_indicator_led};
 
-    calibration_button.fall(calibration_event_queue.event(callback(
-        SimpleSlam::Handle_Calibration_Step_Change, &calibration_args)));
-
-    // Once all calibration steps are gone through,
-    // this event queue will breakout
-    calibration_event_queue.dispatch_forever();
-
-    printf("Completed Calibration\n");
+    // Reuse the stored calibration unless BUTTON1 (active low) is held
+    // through reset to force a new one.
+    const bool force_calibration = calibration_button.read() == 0;
+    if (!force_calibration &&
+        SimpleSlam::Load_Calibration(&calibration_data)) {
+        printf("Loaded Stored Calibration\n");
+    } else {
+        calibration_button.fall(calibration_event_queue.event(callback(
+            SimpleSlam::Handle_Calibration_Step_Change, &calibration_args)));
+
+        // Once all calibration steps are gone through,
+        // this event queue will breakout
+        calibration_event_queue.dispatch_forever();
+
+        printf("Completed Calibration\n");
+        if (!SimpleSlam::Save_Calibration(&calibration_data)) {
+            printf("Failed to Store Calibration\n");
+        }
+    }
 
+    // Steps follow the sample timestamps, the nominal time delta is one
+    // FIFO sample period and only covers the first sample.
     SimpleSlam::Math::InertialNavigationSystem inertial_navigation_system(
-        0.022, SimpleSlam::Math::Vector3(0, 0, 0),
+        1.0 / 208, SimpleSlam::Math::Vector3(0, 0, 0),
         calibration_data.accel_offset, calibration_data.gyro_offset,
-        SimpleSlam::Math::Vector3(0, 0, 0), SimpleSlam::Math::Vector3(0, 0, 0));
+        SimpleSlam::Math::Vector3(0, 0, 0), SimpleSlam::Math::Vector3(0, 0, 0),
+        // Cheapest filter, swap for MadgwickFilter or MahonyFilter when
+        // heading accuracy matters more than CPU time.
+        std::make_unique<SimpleSlam::Math::ComplementaryFilter>(0.05));
+
+    // Start from the resting tilt and the magnetometer heading rather than
+    // flat and facing north. Strapdown stays the default, on test_bench_ins'
+    // stop-go drive the error-state filter (set_navigation_mode) drifts
+    // ~25x less but costs ~50x more per update on the host, so the switch
+    // waits on the disco_bench cycle counts.
+    int16_t magno_x, magno_y, magno_z;
+    if (!SimpleSlam::LIS3MDL::ReadXYZ(magno_x, magno_y, magno_z).has_value()) {
+        inertial_navigation_system.align(
+            calibration_data.accel_offset,
+            SimpleSlam::Math::Adjust_Magnetometer_Vector(
+                SimpleSlam::Math::Vector3(magno_x, magno_y, magno_z),
+                calibration_data.magnetometer_calibration_data));
+    }
 
     // Setup buffered_http_client
     std::unique_ptr<WiFiInterface> wifi(std::make_unique<ISM43362Interface>());
     SimpleSlam::HttpClient http_client(std::move(wifi), 3000);
+    // A batch goes out every ~10 s, keep the connection instead of
+    // paying for DNS and the TCP handshake over the ISM43362 each time
+    http_client.set_keep_alive(true);
     SimpleSlam::BufferedHTTPClient buffered_http_client(http_client, 20,
                                                         WEB_SERVER);
 
@@ -171,17 +299,41 @@ int main() {
     SimpleSlam::CarHardwareInterface car_interface;
     car_interface.init();
 
-    // Begin main processing tasks for ToF and Position Calculator (static
-    // scheduling) Compute time of calculate spatial point should be around
-    // 19ms.
-    sensor_event_queue.call_every(25ms,
-                                  callback(update_intertial_navigation_system,
-                                           &inertial_navigation_system));
-    sensor_event_queue.call_every(
-        500ms, callback([&] {
-            calculate_spatial_point(&inertial_navigation_system,
-                                    &buffered_http_client, &car_interface);
-        }));
+    // Stream IMU samples into the FIFO. INT1 rises once the threshold of 5
+    // samples is reached (~24ms at 208Hz) and the handler drains and
+    // integrates everything queued since the last drain.
+    SimpleSlam::LSM6DSL::fifo_config_t fifo_config{
+        .odr = FIFO_ODR_208HZ,
+        .decimation = FIFO_DEC_NONE,
+        .threshold = 5,
+    };
+    SimpleSlam::LSM6DSL::FIFO_Init(fifo_config);
+    SimpleSlam::LSM6DSL::INT1_Init(INT1_FTH);
+
+    // Begin main processing tasks for ToF and Position Calculator. Readouts
+    // start from the sensor data-ready lines so sampling follows the sensor
+    // ODRs instead of a fixed schedule.
+    spatial_point_args_t spatial_point_args{
+        .inertial_navigation_system = &inertial_navigation_system,
+        .buffered_http_client = &buffered_http_client,
+        .car_interface = &car_interface};
+    // Start ranging while the bus is still blocking-only, once the first
+    // async reads are in flight the ToF setup writes would hit HAL_BUSY.
+    // The ToF ranges on its own every 500ms, the result is picked up on GPIO1.
+    const auto tof_error = SimpleSlam::VL53L0X::Start_Continuous(500);
+    if (tof_error.has_value()) {
+        printf("Failed to Start ToF Ranging: %s\n",
+               tof_error->second.c_str());
+    }
+
+    imu_data_ready.rise(callback(start_imu_read, &inertial_navigation_system));
+    magno_data_ready.rise(start_magnetometer_read);
+    tof_data_ready.fall(callback(start_tof_read, &spatial_point_args));
+
+    // Lines that were already asserted before the handlers were attached
+    // will not produce an edge, so drain them once up front.
+    start_magnetometer_read();
+    start_imu_read(&inertial_navigation_system);
 
     // Begin buffered http client thread
     Thread buffered_http_client_thread;
@@ -18,62 +18,14 @@ SimpleSlam::Math::Vector2 SimpleSlam::Math::Convert_To_Spatial_Point(
     return tof_direction_vector * (double)tof_distance;
 }
 
-SimpleSlam::Math::magnetometer_calibration_t SimpleSlam::Math::Fill_Magnetometer_Calibration_Data(
-    std::vector<SimpleSlam::Math::Vector3> const& readings) {
-    double max_x = -32767;
-    double max_y = -32767;
-    double max_z = -32767;
-    double min_x = 32767;
-    double min_y = 32767;
-    double min_z = 32767;
-
-    for (auto& reading : readings) {
-        const double x = reading.get_x();
-        const double y = reading.get_y();
-        const double z = reading.get_z();
-
-        max_x = std::max(x, max_x);
-        min_x = std::min(x, min_x);
-
-        max_y = std::max(y, max_y);
-        min_y = std::min(y, min_y);
-
-        max_z = std::max(z, max_z);
-        min_z = std::min(z, min_z);
-    }
-
-    const double offset_x = (max_x + min_x) / 2;
-    const double offset_y = (max_y + min_y) / 2;
-    const double offset_z = (max_z + min_z) / 2;
-
-    const double average_delta_x = (max_x - min_x) / 2;
-    const double average_delta_y = (max_y - min_y) / 2;
-    const double average_delta_z = (max_z - min_z) / 2;
-
-    const double average_delta =
-        (average_delta_x + average_delta_y + average_delta_z);
-
-    const double scale_x = average_delta / average_delta_x;
-    const double scale_y = average_delta / average_delta_y;
-    const double scale_z = average_delta / average_delta_z;
-
-    return magnetometer_calibration_t{
-        .offset_x = offset_x,
-        .offset_y = offset_y,
-        .offset_z = offset_z,
-        .scale_x = scale_x,
-        .scale_y = scale_y,
-        .scale_z = scale_z,
-    };
-}
-
 SimpleSlam::Math::Vector3 SimpleSlam::Math::Adjust_Magnetometer_Vector(
     Vector3 const& magnetometer_vector,
     magnetometer_calibration_t const& calibration_data) {
-    return Vector3((magnetometer_vector.get_x() - calibration_data.offset_x) *
-                       calibration_data.scale_x,
-                   (magnetometer_vector.get_y() - calibration_data.offset_y) *
-                       calibration_data.scale_y,
-                   (magnetometer_vector.get_z() - calibration_data.offset_z) *
-                       calibration_data.scale_z);
-}
\ No newline at end of file
+    const double x = magnetometer_vector.get_x() - calibration_data.offset[0];
+    const double y = magnetometer_vector.get_y() - calibration_data.offset[1];
+    const double z = magnetometer_vector.get_z() - calibration_data.offset[2];
+    const double (&m)[3][3] = calibration_data.soft_iron;
+    return Vector3(m[0][0] * x + m[0][1] * y + m[0][2] * z,
+                   m[1][0] * x + m[1][1] * y + m[1][2] * z,
+                   m[2][0] * x + m[2][1] * y + m[2][2] * z);
+}
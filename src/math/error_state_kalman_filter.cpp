@@ -0,0 +1,207 @@
+#include "math/error_state_kalman_filter.h"
+
+#include <math.h>
+
+typedef SimpleSlam::Math::Matrix<3, 3> matrix3_t;
+
+static matrix3_t rotation_matrix(const SimpleSlam::Math::Quaternion& q) {
+    const double x = q.x(), y = q.y(), z = q.z(), w = q.w();
+    matrix3_t r;
+    r(0, 0) = 1 - 2 * (y * y + z * z);
+    r(0, 1) = 2 * (x * y - w * z);
+    r(0, 2) = 2 * (x * z + w * y);
+    r(1, 0) = 2 * (x * y + w * z);
+    r(1, 1) = 1 - 2 * (x * x + z * z);
+    r(1, 2) = 2 * (y * z - w * x);
+    r(2, 0) = 2 * (x * z - w * y);
+    r(2, 1) = 2 * (y * z + w * x);
+    r(2, 2) = 1 - 2 * (x * x + y * y);
+    return r;
+}
+
+/**
+ * Cross product matrix, skew(v) * u == v x u
+ */
+static matrix3_t skew(const SimpleSlam::Math::Vector3& v) {
+    matrix3_t s;
+    s(0, 1) = -v[2];
+    s(0, 2) = v[1];
+    s(1, 0) = v[2];
+    s(1, 2) = -v[0];
+    s(2, 0) = -v[1];
+    s(2, 1) = v[0];
+    return s;
+}
+
+/**
+ * Small rotation as a quaternion, first order in the angle so no trig.
+ */
+static SimpleSlam::Math::Quaternion small_rotation(
+    const SimpleSlam::Math::Vector3& angle) {
+    return SimpleSlam::Math::Quaternion(angle * 0.5, 1).normalize();
+}
+
+SimpleSlam::Math::ErrorStateKalmanFilter::ErrorStateKalmanFilter(
+    const Quaternion& orientation, const Vector3& velocity,
+    const Vector3& position, const Vector3& gyro_bias,
+    const Vector3& accel_bias, const eskf_config_t& config)
+    : _config{config},
+      _orientation{orientation},
+      _velocity{velocity},
+      _position{position},
+      _gyro_bias{gyro_bias},
+      _accel_bias{accel_bias} {
+    const float attitude_var =
+        config.initial_attitude_sigma * config.initial_attitude_sigma;
+    const float gyro_bias_var =
+        config.initial_gyro_bias_sigma * config.initial_gyro_bias_sigma;
+    const float accel_bias_var =
+        config.initial_accel_bias_sigma * config.initial_accel_bias_sigma;
+
+    // Velocity and position start known exactly, the board is at rest
+    _covariance.set_block(_ATTITUDE, _ATTITUDE, matrix3_t::diagonal(attitude_var));
+    _covariance.set_block(_GYRO_BIAS, _GYRO_BIAS, matrix3_t::diagonal(gyro_bias_var));
+    _covariance.set_block(_ACCEL_BIAS, _ACCEL_BIAS, matrix3_t::diagonal(accel_bias_var));
+}
+
+void SimpleSlam::Math::ErrorStateKalmanFilter::predict(
+    const Vector3& angular_velocity, const Vector3& force, double time_delta) {
+    const Vector3 rate = angular_velocity - _gyro_bias;
+    const Vector3 body_accel = force - _accel_bias;
+
+    const matrix3_t rotation = rotation_matrix(_orientation);
+    const Vector3 world_force = _orientation.rotate(body_accel);
+    const Vector3 world_accel = world_force - Vector3(0, 0, _GRAVITY);
+
+    // Nominal state
+    _position = _position + _velocity * time_delta +
+                world_accel * (0.5 * time_delta * time_delta);
+    _velocity = _velocity + world_accel * time_delta;
+    _orientation = (_orientation * small_rotation(rate * time_delta)).normalize();
+
+    // Error state transition, F = I + A dt
+    const float dt = time_delta;
+    covariance_t transition = covariance_t::identity();
+    transition.set_block(_ATTITUDE, _GYRO_BIAS, rotation * -dt);
+    transition.set_block(_VELOCITY, _ATTITUDE, skew(world_force) * -dt);
+    transition.set_block(_VELOCITY, _ACCEL_BIAS, rotation * -dt);
+    transition.set_block(_POSITION, _VELOCITY, matrix3_t::diagonal(dt));
+
+    _covariance = (transition * _covariance * transition.transpose());
+
+    // Process noise, isotropic so it is the same in either frame
+    const float gyro_var = _config.gyro_noise * _config.gyro_noise * dt;
+    const float accel_var = _config.accel_noise * _config.accel_noise * dt;
+    const float gyro_walk_var = _config.gyro_bias_walk * _config.gyro_bias_walk * dt;
+    const float accel_walk_var = _config.accel_bias_walk * _config.accel_bias_walk * dt;
+    for (size_t i = 0; i < 3; i++) {
+        _covariance(_ATTITUDE + i, _ATTITUDE + i) += gyro_var;
+        _covariance(_VELOCITY + i, _VELOCITY + i) += accel_var;
+        _covariance(_GYRO_BIAS + i, _GYRO_BIAS + i) += gyro_walk_var;
+        _covariance(_ACCEL_BIAS + i, _ACCEL_BIAS + i) += accel_walk_var;
+    }
+}
+
+void SimpleSlam::Math::ErrorStateKalmanFilter::update_stationary(
+    const Vector3& angular_velocity) {
+    // ZUPT, measured velocity is zero
+    Matrix<3, STATE_SIZE> h_velocity;
+    h_velocity.set_block(0, _VELOCITY, matrix3_t::identity());
+    Matrix<3, 1> velocity_innovation;
+    for (size_t i = 0; i < 3; i++) {
+        velocity_innovation(i, 0) = -_velocity[i];
+    }
+    update(h_velocity, velocity_innovation,
+           matrix3_t::diagonal(_config.zero_velocity_noise * _config.zero_velocity_noise));
+
+    // Zero angular rate, the gyro reading is all bias
+    Matrix<3, STATE_SIZE> h_rate;
+    h_rate.set_block(0, _GYRO_BIAS, matrix3_t::identity());
+    Matrix<3, 1> rate_innovation;
+    const Vector3 residual = angular_velocity - _gyro_bias;
+    for (size_t i = 0; i < 3; i++) {
+        rate_innovation(i, 0) = residual[i];
+    }
+    update(h_rate, rate_innovation,
+           matrix3_t::diagonal(_config.zero_rate_noise * _config.zero_rate_noise));
+}
+
+void SimpleSlam::Math::ErrorStateKalmanFilter::update_heading(
+    const Vector3& magno) {
+    const Vector3 magno_world = _orientation.rotate(magno);
+    if (magno_world[0] == 0 && magno_world[1] == 0) {
+        return;
+    }
+
+    // North is world x, so the horizontal field angle is the heading error.
+    // With the attitude error in the world frame the field appears rotated
+    // by minus the yaw error.
+    Matrix<1, STATE_SIZE> h;
+    h(0, _ATTITUDE + 2) = -1;
+    Matrix<1, 1> innovation;
+    innovation(0, 0) = std::atan2(magno_world[1], magno_world[0]);
+    Matrix<1, 1> noise;
+    noise(0, 0) = _config.heading_noise * _config.heading_noise;
+    update(h, innovation, noise);
+}
+
+template <size_t M>
+void SimpleSlam::Math::ErrorStateKalmanFilter::update(
+    const Matrix<M, STATE_SIZE>& h, const Matrix<M, 1>& innovation,
+    const Matrix<M, M>& noise) {
+    const Matrix<STATE_SIZE, M> pht = _covariance * h.transpose();
+    Matrix<M, M> innovation_covariance_inverse;
+    if (!Invert(h * pht + noise, innovation_covariance_inverse)) {
+        return;
+    }
+    const Matrix<STATE_SIZE, M> gain = pht * innovation_covariance_inverse;
+
+    inject(gain * innovation);
+    _covariance =
+        ((covariance_t::identity() - gain * h) * _covariance).symmetrize();
+}
+
+void SimpleSlam::Math::ErrorStateKalmanFilter::inject(
+    const Matrix<STATE_SIZE, 1>& error) {
+    const Vector3 attitude(error(_ATTITUDE, 0), error(_ATTITUDE + 1, 0),
+                           error(_ATTITUDE + 2, 0));
+    _orientation = (small_rotation(attitude) * _orientation).normalize();
+    _velocity = _velocity + Vector3(error(_VELOCITY, 0), error(_VELOCITY + 1, 0),
+                                    error(_VELOCITY + 2, 0));
+    _position = _position + Vector3(error(_POSITION, 0), error(_POSITION + 1, 0),
+                                    error(_POSITION + 2, 0));
+    _gyro_bias = _gyro_bias + Vector3(error(_GYRO_BIAS, 0), error(_GYRO_BIAS + 1, 0),
+                                      error(_GYRO_BIAS + 2, 0));
+    _accel_bias = _accel_bias + Vector3(error(_ACCEL_BIAS, 0), error(_ACCEL_BIAS + 1, 0),
+                                        error(_ACCEL_BIAS + 2, 0));
+}
+
+SimpleSlam::Math::Quaternion
+SimpleSlam::Math::ErrorStateKalmanFilter::get_orientation() const {
+    return _orientation;
+}
+
+SimpleSlam::Math::Vector3
+SimpleSlam::Math::ErrorStateKalmanFilter::get_velocity() const {
+    return _velocity;
+}
+
+SimpleSlam::Math::Vector3
+SimpleSlam::Math::ErrorStateKalmanFilter::get_position() const {
+    return _position;
+}
+
+SimpleSlam::Math::Vector3
+SimpleSlam::Math::ErrorStateKalmanFilter::get_gyro_bias() const {
+    return _gyro_bias;
+}
+
+SimpleSlam::Math::Vector3
+SimpleSlam::Math::ErrorStateKalmanFilter::get_accel_bias() const {
+    return _accel_bias;
+}
+
+const SimpleSlam::Math::ErrorStateKalmanFilter::covariance_t&
+SimpleSlam::Math::ErrorStateKalmanFilter::get_covariance() const {
+    return _covariance;
+}
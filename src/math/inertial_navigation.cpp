@@ -1,8 +1,6 @@
 
 #include <math.h>
-#include <deque>
 
-#include "mbed.h"
 #include "math/inertial_navigation.h"
 #include "math/quaternion.h"
 #include "math/conversion.h"
@@ -11,14 +9,22 @@
 SimpleSlam::Math::InertialNavigationSystem::InertialNavigationSystem(
     const double time_delta, const Vector3& e_north,
     const Vector3& accel_offset, const Vector3& gyro_offset,
-    const Vector3& velocity, const Vector3& position)
+    const Vector3& velocity, const Vector3& position,
+    std::unique_ptr<OrientationFilter> orientation_filter)
     : _time_delta{time_delta},
+      _integrator{Integrator::EULER},
+      _has_timestamp{false},
+      _last_timestamp_us{0},
+      _last_world_accel{0, 0, 0},
+      _stationary_samples{0},
       _e_north{e_north},
       _q{Quaternion(0, 0, 0, 1)},
+      _orientation_filter{std::move(orientation_filter)},
       _accel_offset{accel_offset},
       _gyro_offset{gyro_offset},
       _velocity{velocity},
-      _position{position} {}
+      _position{position},
+      _samples{(size_t)(_ZUPT_WINDOW / time_delta + 0.5)} {}
 
 SimpleSlam::Math::Vector3
 SimpleSlam::Math::InertialNavigationSystem::get_velocity() const {
@@ -30,90 +36,233 @@ SimpleSlam::Math::InertialNavigationSystem::get_position() const {
     return _position;
 }
 
+SimpleSlam::Math::Quaternion
+SimpleSlam::Math::InertialNavigationSystem::get_orientation() const {
+    return _q;
+}
+
+SimpleSlam::Math::Vector3
+SimpleSlam::Math::InertialNavigationSystem::get_gyro_offset() const {
+    return _gyro_offset;
+}
+
+SimpleSlam::Math::Vector3
+SimpleSlam::Math::InertialNavigationSystem::get_accel_offset() const {
+    return _accel_offset;
+}
+
 void SimpleSlam::Math::InertialNavigationSystem::update_position(
     const Vector3& angular_velocity, const Vector3& force,
     const Vector3& magno) {
-    // Gyro Integration
-    Quaternion rot = _q;
-    Quaternion q_delta(0.5 * angular_velocity[0] * _time_delta,
-                       0.5 * angular_velocity[1] * _time_delta,
-                       0.5 * angular_velocity[2] * _time_delta, 1);
-    q_delta = q_delta / q_delta.norm();
-    rot = rot * q_delta;
-    rot = rot / rot.norm();
-
-    // Tilt Correction
-    Quaternion q_a_body(force[0], force[1], force[2], 0);
-    q_a_body = q_a_body / q_a_body.norm();
-    const Quaternion q_a_world = rot * q_a_body * rot.conjugate();
-    const Vector3 v = q_a_world.complex().normalize();
-
-    const double denom = sqrt(v[0] * v[0] + v[1] * v[1]);
-    const Vector3 n(v[1] / denom, -1 * v[0] / denom, 0);
-    const double phi = std::atan2(denom, v[2]);
-    Quaternion rot_c =
-        Quaternion::axis_angle_to_quat(0.05 * phi, n.normalize());
-
-    rot_c = rot_c / rot_c.norm();
-    rot_c = rot_c * rot;
-    rot_c = rot_c / rot_c.norm();
-
-    // Yaw Correction w/ Magnetometer
-    const Quaternion mag_body(magno[0], magno[1], magno[2], 0);
-    const Quaternion magno_world = rot_c * mag_body * rot_c.conjugate();
-    const Vector3 mag = Vector3(magno_world.x(), magno_world.y(), 0).normalize();
-
-    const int signum = mag[1] == 0 ? 0 : mag[1] > 0 ? 1 : -1;
-    const Vector3 north(0,0, -1 * signum);
-    const double gamma = std::atan2(abs(mag[1]), mag[0]);
-    Quaternion rot_c2 =
-        Quaternion::axis_angle_to_quat(0.05 * gamma, north / north.magnitude());
-
-    rot_c2 = rot_c2 / rot_c2.norm();
-    rot_c2 = rot_c2 * rot_c;
-    rot_c2 = rot_c2 / rot_c2.norm();
+    integrate(angular_velocity, force, magno, _time_delta);
+    update_heading(magno);
+}
+
+void SimpleSlam::Math::InertialNavigationSystem::update_position(
+    const Vector3& angular_velocity, const Vector3& force,
+    const Vector3& magno, uint32_t timestamp_us) {
+    integrate(angular_velocity, force, magno, elapsed_time(timestamp_us));
+    update_heading(magno);
+}
+
+void SimpleSlam::Math::InertialNavigationSystem::set_integrator(
+    Integrator integrator) {
+    _integrator = integrator;
+}
+
+/**
+ * Seconds since the previous timestamp. Unsigned subtraction keeps this
+ * right across the 32-bit microsecond wraparound (~71 minutes).
+ */
+double SimpleSlam::Math::InertialNavigationSystem::elapsed_time(
+    uint32_t timestamp_us) {
+    const bool had_timestamp = _has_timestamp;
+    const uint32_t elapsed_us = timestamp_us - _last_timestamp_us;
+    _has_timestamp = true;
+    _last_timestamp_us = timestamp_us;
+
+    const double time_delta = elapsed_us / 1e6;
+    if (!had_timestamp || time_delta <= 0 || time_delta > _MAX_TIME_DELTA) {
+        return _time_delta;
+    }
+    return time_delta;
+}
+
+void SimpleSlam::Math::InertialNavigationSystem::align(const Vector3& force,
+                                                       const Vector3& magno) {
+    if (force.dot(force) == 0) {
+        return;
+    }
+
+    // Roll and pitch take the resting force onto world z
+    const Quaternion tilt =
+        Partial_Rotation(force.normalize(), Vector3(0, 0, 1), 1.0);
+
+    // Yaw takes the levelled horizontal field onto world x
+    const Vector3 magno_level = tilt.rotate(magno);
+    const Vector3 heading(magno_level[0], magno_level[1], 0);
+    Quaternion yaw;
+    if (heading.dot(heading) > 0) {
+        yaw = Partial_Rotation(heading.normalize(), Vector3(1, 0, 0), 1.0);
+    }
+
+    _q = (yaw * tilt).normalize();
+    _accel_offset = _q.rotate(force);
+}
+
+void SimpleSlam::Math::InertialNavigationSystem::set_navigation_mode(
+    NavigationMode mode, const eskf_config_t& config) {
+    if (mode == NavigationMode::STRAPDOWN) {
+        _error_state_filter.reset();
+        return;
+    }
+    // The world frame accel offset is gravity plus the bias, what is left
+    // after gravity is the bias in the body frame
+    const Vector3 accel_bias =
+        _q.rotate_inverse(_accel_offset - Vector3(0, 0, 1)) * 9.8;
+    _error_state_filter = std::make_unique<ErrorStateKalmanFilter>(
+        _q, _velocity, _position, _gyro_offset, accel_bias, config);
+}
+
+void SimpleSlam::Math::InertialNavigationSystem::update_sample(
+    const Vector3& angular_velocity, const Vector3& force,
+    const Vector3& magno, uint32_t timestamp_us) {
+    add_sample(force * 9.8);
+    integrate(angular_velocity, force, magno, elapsed_time(timestamp_us));
+}
+
+/**
+ * Error-state heading fix, once per update or once per batch since the
+ * magnetometer is shared by the batch
+ */
+void SimpleSlam::Math::InertialNavigationSystem::update_heading(
+    const Vector3& magno) {
+    if (_error_state_filter) {
+        _error_state_filter->update_heading(magno);
+        _q = _error_state_filter->get_orientation();
+    }
+}
+
+void SimpleSlam::Math::InertialNavigationSystem::integrate(
+    const Vector3& angular_velocity, const Vector3& force,
+    const Vector3& magno, double time_delta) {
+    if (_error_state_filter) {
+        integrate_error_state(angular_velocity, force, time_delta);
+        return;
+    }
+
+    _q = _orientation_filter->update(_q, angular_velocity - _gyro_offset,
+                                     force, magno, time_delta);
 
     // Rotate force in body frame into local frame
-    const Quaternion q_u_body(force[0], force[1], force[2], 0);
-    const Quaternion q_u_world = rot_c2 * q_u_body * rot_c2.conjugate();
-    const Vector3 world_force = q_u_world.complex() - _accel_offset;
+    const Vector3 world_force = _q.rotate(force);
 
-    // Set rotation to our newly corrected quaternion
-    _q = rot_c2;
+    const Vector3 world_accel = (world_force - _accel_offset) * 9.8;
 
     // Zero velocity update rule
     const double variance = calculate_variance();
     if (variance < _VARIANCE_THRESHOLD) {
         _velocity = Vector3(0, 0, 0);
-    } else {
-        _velocity = _velocity + (world_force * 9.8 * _time_delta);
+        _last_world_accel = world_accel;
+        refine_offsets(angular_velocity, world_force, time_delta);
+        return;
     }
 
-    // Position update
-    _position = _position + (_velocity * _time_delta);
+    _stationary_samples = 0;
+    integrate_motion(world_accel, time_delta);
 }
 
-void SimpleSlam::Math::InertialNavigationSystem::add_sample(
-    const Vector3& sample) {
-    const int size = _samples.size();
-    if (size == _NUM_SAMPLES) {
-        _samples.pop_front();
+/**
+ * While stationary the gyro reads only its offset and the world force only
+ * gravity plus the accel offset, so pull both offsets towards the readings
+ * with an exponential filter.
+ */
+void SimpleSlam::Math::InertialNavigationSystem::refine_offsets(
+    const Vector3& angular_velocity, const Vector3& world_force,
+    double time_delta) {
+    // The variance window still holds motion at the start of a stop
+    if (_stationary_samples < _samples.window()) {
+        _stationary_samples++;
+        return;
+    }
+    // Steady accel with a turning gyro is a spin in place
+    if ((angular_velocity - _gyro_offset).magnitude() > _MAX_STATIONARY_RATE) {
+        return;
     }
-    _samples.push_back(sample);
+
+    const double alpha = time_delta / (_OFFSET_TIME_CONSTANT + time_delta);
+    _gyro_offset = _gyro_offset + (angular_velocity - _gyro_offset) * alpha;
+    _accel_offset = _accel_offset + (world_force - _accel_offset) * alpha;
 }
 
-double SimpleSlam::Math::InertialNavigationSystem::calculate_variance() const {
-    double variance = 0;
-    double mean = 0;
+/**
+ * Advance velocity and position by one step, the acceleration moving from
+ * the previous sample's value to world_accel over the step.
+ */
+void SimpleSlam::Math::InertialNavigationSystem::integrate_motion(
+    const Vector3& world_accel, double time_delta) {
+    const Vector3 start_accel = _last_world_accel;
+    _last_world_accel = world_accel;
+
+    switch (_integrator) {
+        case Integrator::TRAPEZOIDAL: {
+            const Vector3 velocity =
+                _velocity + (start_accel + world_accel) * (0.5 * time_delta);
+            _position = _position + (_velocity + velocity) * (0.5 * time_delta);
+            _velocity = velocity;
+            break;
+        }
+        case Integrator::RK4: {
+            // State is (position, velocity), the derivative (velocity, accel)
+            const double half_step = 0.5 * time_delta;
+            const Vector3 mid_accel = (start_accel + world_accel) * 0.5;
 
-    for (auto& sample : _samples) {
-        mean += pow(sample.magnitude(), 2);
+            const Vector3 k1_velocity = _velocity;
+            const Vector3 k2_velocity = _velocity + start_accel * half_step;
+            const Vector3 k3_velocity = _velocity + mid_accel * half_step;
+            const Vector3 k4_velocity = _velocity + mid_accel * time_delta;
+
+            _position = _position + (k1_velocity + k2_velocity * 2 +
+                                     k3_velocity * 2 + k4_velocity) *
+                                        (time_delta / 6);
+            _velocity = _velocity + (start_accel + mid_accel * 4 + world_accel) *
+                                        (time_delta / 6);
+            break;
+        }
+        case Integrator::EULER:
+        default:
+            _velocity = _velocity + (world_accel * time_delta);
+            _position = _position + (_velocity * time_delta);
+            break;
     }
-    mean /= _NUM_SAMPLES;
+}
 
-    for (auto& sample : _samples) {
-        const double norm2 = pow(sample.magnitude(), 2);
-        variance += pow((norm2 - mean), 2);
+void SimpleSlam::Math::InertialNavigationSystem::integrate_error_state(
+    const Vector3& angular_velocity, const Vector3& force, double time_delta) {
+    _error_state_filter->predict(angular_velocity, force * 9.8, time_delta);
+
+    // ZUPT events become measurements instead of hard velocity resets
+    if (calculate_variance() < _VARIANCE_THRESHOLD) {
+        _error_state_filter->update_stationary(angular_velocity);
     }
-    return variance / _NUM_SAMPLES;
-}
\ No newline at end of file
+
+    _q = _error_state_filter->get_orientation();
+    _velocity = _error_state_filter->get_velocity();
+    _position = _error_state_filter->get_position();
+    // The filter refines both biases itself from the same stationary
+    // samples, keep them for a switch back to strapdown
+    _gyro_offset = _error_state_filter->get_gyro_bias();
+    _accel_offset =
+        _q.rotate(_error_state_filter->get_accel_bias() / 9.8) +
+        Vector3(0, 0, 1);
+}
+
+void SimpleSlam::Math::InertialNavigationSystem::add_sample(
+    const Vector3& sample) {
+    // Squared magnitude directly, no need for the sqrt in magnitude()
+    _samples.add(sample.dot(sample));
+}
+
+double SimpleSlam::Math::InertialNavigationSystem::calculate_variance() const {
+    return _samples.variance();
+}
@@ -0,0 +1,233 @@
+#include "math/magnetometer_calibrator.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+typedef SimpleSlam::Math::Matrix<3, 3, double> matrix3d_t;
+
+/**
+ * Cyclic Jacobi eigen decomposition of a symmetric 3x3 matrix. On return
+ * the diagonal of a holds the eigenvalues and the columns of vectors the
+ * matching eigenvectors.
+ */
+static void symmetric_eigen(matrix3d_t& a, matrix3d_t& vectors) {
+    vectors = matrix3d_t::identity();
+    for (int sweep = 0; sweep < 16; sweep++) {
+        const double off_diagonal =
+            a(0, 1) * a(0, 1) + a(0, 2) * a(0, 2) + a(1, 2) * a(1, 2);
+        if (off_diagonal < 1e-24) {
+            return;
+        }
+
+        for (size_t p = 0; p < 2; p++) {
+            for (size_t q = p + 1; q < 3; q++) {
+                if (a(p, q) == 0) {
+                    continue;
+                }
+                // Rotation zeroing a(p, q)
+                const double theta = (a(q, q) - a(p, p)) / (2 * a(p, q));
+                const double t = (theta >= 0 ? 1 : -1) /
+                                 (fabs(theta) + sqrt(theta * theta + 1));
+                const double c = 1 / sqrt(t * t + 1);
+                const double s = t * c;
+
+                for (size_t k = 0; k < 3; k++) {
+                    const double a_kp = a(k, p);
+                    const double a_kq = a(k, q);
+                    a(k, p) = c * a_kp - s * a_kq;
+                    a(k, q) = s * a_kp + c * a_kq;
+                }
+                for (size_t k = 0; k < 3; k++) {
+                    const double a_pk = a(p, k);
+                    const double a_qk = a(q, k);
+                    a(p, k) = c * a_pk - s * a_qk;
+                    a(q, k) = s * a_pk + c * a_qk;
+                }
+                for (size_t k = 0; k < 3; k++) {
+                    const double v_kp = vectors(k, p);
+                    const double v_kq = vectors(k, q);
+                    vectors(k, p) = c * v_kp - s * v_kq;
+                    vectors(k, q) = s * v_kp + c * v_kq;
+                }
+            }
+        }
+    }
+}
+
+SimpleSlam::Math::MagnetometerCalibrator::MagnetometerCalibrator() {
+    reset();
+}
+
+void SimpleSlam::Math::MagnetometerCalibrator::reset() {
+    _normal = Matrix<_NUM_PARAMS, _NUM_PARAMS, double>();
+    _rhs = Matrix<_NUM_PARAMS, 1, double>();
+    _count = 0;
+    for (size_t i = 0; i < 3; i++) {
+        _min[i] = 32767;
+        _max[i] = -32767;
+    }
+}
+
+size_t SimpleSlam::Math::MagnetometerCalibrator::count() const {
+    return _count;
+}
+
+void SimpleSlam::Math::MagnetometerCalibrator::add(const Vector3& reading) {
+    for (size_t i = 0; i < 3; i++) {
+        _min[i] = std::min(_min[i], reading[i]);
+        _max[i] = std::max(_max[i], reading[i]);
+    }
+
+    const double x = reading[0] / _FIT_SCALE;
+    const double y = reading[1] / _FIT_SCALE;
+    const double z = reading[2] / _FIT_SCALE;
+    const double row[_NUM_PARAMS] = {
+        x * x, y * y, z * z, 2 * x * y, 2 * x * z, 2 * y * z, 2 * x, 2 * y, 2 * z,
+    };
+
+    for (size_t i = 0; i < _NUM_PARAMS; i++) {
+        for (size_t j = i; j < _NUM_PARAMS; j++) {
+            _normal(i, j) += row[i] * row[j];
+        }
+        _rhs(i, 0) += row[i];
+    }
+    _count++;
+}
+
+SimpleSlam::Math::magnetometer_calibration_t
+SimpleSlam::Math::MagnetometerCalibrator::solve() const {
+    magnetometer_calibration_t calibration;
+    if (_count >= _MIN_FIT_SAMPLES && fit_ellipsoid(calibration)) {
+        return calibration;
+    }
+    return fit_min_max();
+}
+
+/**
+ * Solve for the quadric x^T Q x + 2 g^T x = 1, then rewrite it as
+ * (x - c)^T M (x - c) = 1 with centre c = -Q^-1 g. The soft-iron matrix is
+ * the symmetric square root of M, scaled so the corrected field keeps the
+ * ellipsoid's mean radius.
+ */
+bool SimpleSlam::Math::MagnetometerCalibrator::fit_ellipsoid(
+    magnetometer_calibration_t& calibration) const {
+    // Without a spread on every axis the normal equations are near singular
+    // but not exactly so, and Solve() happily returns noise
+    double max_span = 0;
+    double min_span = _max[0] - _min[0];
+    for (size_t i = 0; i < 3; i++) {
+        max_span = std::max(max_span, _max[i] - _min[i]);
+        min_span = std::min(min_span, _max[i] - _min[i]);
+    }
+    if (!(min_span >= _MIN_SPAN_RATIO * max_span)) {
+        return false;
+    }
+
+    Matrix<_NUM_PARAMS, _NUM_PARAMS, double> normal = _normal;
+    for (size_t i = 0; i < _NUM_PARAMS; i++) {
+        for (size_t j = 0; j < i; j++) {
+            normal(i, j) = normal(j, i);
+        }
+    }
+    Matrix<_NUM_PARAMS, 1, double> params = _rhs;
+    if (!Solve(normal, params)) {
+        return false;
+    }
+
+    matrix3d_t quadric;
+    quadric(0, 0) = params(0, 0);
+    quadric(1, 1) = params(1, 0);
+    quadric(2, 2) = params(2, 0);
+    quadric(0, 1) = quadric(1, 0) = params(3, 0);
+    quadric(0, 2) = quadric(2, 0) = params(4, 0);
+    quadric(1, 2) = quadric(2, 1) = params(5, 0);
+    Matrix<3, 1, double> linear;
+    linear(0, 0) = params(6, 0);
+    linear(1, 0) = params(7, 0);
+    linear(2, 0) = params(8, 0);
+
+    matrix3d_t quadric_inverse;
+    if (!Invert(quadric, quadric_inverse)) {
+        return false;
+    }
+    const Matrix<3, 1, double> centre = quadric_inverse * linear * -1.0;
+    const double k = 1 + (centre.transpose() * quadric * centre)(0, 0);
+    if (k == 0) {
+        return false;
+    }
+
+    matrix3d_t eigenvalues = quadric * (1 / k);
+    matrix3d_t eigenvectors;
+    symmetric_eigen(eigenvalues, eigenvectors);
+
+    // Every axis must be positive for an ellipsoid, anything else means
+    // the readings did not cover enough orientations
+    double product = 1;
+    double min_lambda = eigenvalues(0, 0);
+    double max_lambda = eigenvalues(0, 0);
+    matrix3d_t root;
+    for (size_t i = 0; i < 3; i++) {
+        const double lambda = eigenvalues(i, i);
+        if (!(lambda > 0)) {
+            return false;
+        }
+        product *= lambda;
+        min_lambda = std::min(min_lambda, lambda);
+        max_lambda = std::max(max_lambda, lambda);
+        root(i, i) = sqrt(lambda);
+    }
+    // A long thin ellipsoid is a poorly constrained fit, not real soft iron
+    if (max_lambda > _MAX_EIGENVALUE_RATIO * min_lambda) {
+        return false;
+    }
+
+    // Geometric mean radius, (r1 r2 r3)^(1/3) with r = 1 / sqrt(lambda)
+    const double radius = pow(product, -1.0 / 6);
+    const matrix3d_t soft_iron =
+        eigenvectors * root * eigenvectors.transpose() * radius;
+
+    for (size_t i = 0; i < 3; i++) {
+        calibration.offset[i] = centre(i, 0) * _FIT_SCALE;
+        for (size_t j = 0; j < 3; j++) {
+            calibration.soft_iron[i][j] = soft_iron(i, j);
+        }
+    }
+    return true;
+}
+
+/**
+ * Hard-iron offset from the middle of each axis range and a diagonal scale
+ * equalizing the ranges. An axis whose range is mostly noise (the board was
+ * never turned through it) gets no offset and unit scale, its midpoint
+ * would be the earth field itself rather than the hard iron.
+ */
+SimpleSlam::Math::magnetometer_calibration_t
+SimpleSlam::Math::MagnetometerCalibrator::fit_min_max() const {
+    magnetometer_calibration_t calibration = {};
+    double deltas[3];
+    double max_delta = 0;
+    for (size_t i = 0; i < 3; i++) {
+        deltas[i] = _count ? (_max[i] - _min[i]) / 2 : 0;
+        max_delta = std::max(max_delta, deltas[i]);
+    }
+
+    double delta_sum = 0;
+    int covered_axes = 0;
+    bool covered[3];
+    for (size_t i = 0; i < 3; i++) {
+        covered[i] = deltas[i] > 0 && deltas[i] >= _MIN_SPAN_RATIO * max_delta;
+        if (covered[i]) {
+            calibration.offset[i] = (_max[i] + _min[i]) / 2;
+            delta_sum += deltas[i];
+            covered_axes++;
+        }
+    }
+    // Uncovered axes keep unit scale and stay out of the average
+    const double average_delta = covered_axes ? delta_sum / covered_axes : 0;
+    for (size_t i = 0; i < 3; i++) {
+        calibration.soft_iron[i][i] =
+            covered[i] ? average_delta / deltas[i] : 1;
+    }
+    return calibration;
+}
@@ -0,0 +1,141 @@
+#include "math/orientation_filter.h"
+
+#include <math.h>
+
+/**
+ * Complementary Filter
+ */
+SimpleSlam::Math::ComplementaryFilter::ComplementaryFilter(double gain)
+    : _gain{gain} {}
+
+SimpleSlam::Math::Quaternion SimpleSlam::Math::ComplementaryFilter::update(
+    const Quaternion& orientation, const Vector3& angular_velocity,
+    const Vector3& force, const Vector3& magno, double time_delta) {
+    return Complementary_Update(orientation, angular_velocity, force, magno,
+                                time_delta, _gain);
+}
+
+/**
+ * Madgwick Filter
+ */
+SimpleSlam::Math::MadgwickFilter::MadgwickFilter(double beta) : _beta{beta} {}
+
+SimpleSlam::Math::Quaternion SimpleSlam::Math::MadgwickFilter::update(
+    const Quaternion& orientation, const Vector3& angular_velocity,
+    const Vector3& force, const Vector3& magno, double time_delta) {
+    const double q0 = orientation.w();
+    const double q1 = orientation.x();
+    const double q2 = orientation.y();
+    const double q3 = orientation.z();
+
+    // Rate of change of quaternion from gyroscope
+    Quaternion q_dot = orientation * Quaternion(angular_velocity * 0.5, 0);
+
+    if (force.dot(force) == 0 || magno.dot(magno) == 0) {
+        return (orientation + q_dot * time_delta).normalize();
+    }
+
+    const Vector3 a = force.normalize();
+    const Vector3 m = magno.normalize();
+    const double ax = a[0], ay = a[1], az = a[2];
+    const double mx = m[0], my = m[1], mz = m[2];
+
+    // Auxiliary variables to avoid repeated arithmetic
+    const double _2q0mx = 2 * q0 * mx;
+    const double _2q0my = 2 * q0 * my;
+    const double _2q0mz = 2 * q0 * mz;
+    const double _2q1mx = 2 * q1 * mx;
+    const double _2q0 = 2 * q0;
+    const double _2q1 = 2 * q1;
+    const double _2q2 = 2 * q2;
+    const double _2q3 = 2 * q3;
+    const double _2q0q2 = 2 * q0 * q2;
+    const double _2q2q3 = 2 * q2 * q3;
+    const double q0q0 = q0 * q0;
+    const double q0q1 = q0 * q1;
+    const double q0q2 = q0 * q2;
+    const double q0q3 = q0 * q3;
+    const double q1q1 = q1 * q1;
+    const double q1q2 = q1 * q2;
+    const double q1q3 = q1 * q3;
+    const double q2q2 = q2 * q2;
+    const double q2q3 = q2 * q3;
+    const double q3q3 = q3 * q3;
+
+    // Reference direction of Earth's magnetic field
+    const double hx = mx * q0q0 - _2q0my * q3 + _2q0mz * q2 + mx * q1q1 +
+                      _2q1 * my * q2 + _2q1 * mz * q3 - mx * q2q2 - mx * q3q3;
+    const double hy = _2q0mx * q3 + my * q0q0 - _2q0mz * q1 + _2q1mx * q2 -
+                      my * q1q1 + my * q2q2 + _2q2 * mz * q3 - my * q3q3;
+    const double _2bx = sqrt(hx * hx + hy * hy);
+    const double _2bz = -_2q0mx * q2 + _2q0my * q1 + mz * q0q0 + _2q1mx * q3 -
+                        mz * q1q1 + _2q2 * my * q3 - mz * q2q2 + mz * q3q3;
+    const double _4bx = 2 * _2bx;
+    const double _4bz = 2 * _2bz;
+
+    // Objective function residuals, gravity then magnetic field
+    const double fgx = 2 * q1q3 - _2q0q2 - ax;
+    const double fgy = 2 * q0q1 + _2q2q3 - ay;
+    const double fgz = 1 - 2 * q1q1 - 2 * q2q2 - az;
+    const double fbx = _2bx * (0.5 - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx;
+    const double fby = _2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my;
+    const double fbz = _2bx * (q0q2 + q1q3) + _2bz * (0.5 - q1q1 - q2q2) - mz;
+
+    // Gradient descent step, J^T f
+    const double s0 = -_2q2 * fgx + _2q1 * fgy - _2bz * q2 * fbx +
+                      (-_2bx * q3 + _2bz * q1) * fby + _2bx * q2 * fbz;
+    const double s1 = _2q3 * fgx + _2q0 * fgy - 2 * _2q1 * fgz +
+                      _2bz * q3 * fbx + (_2bx * q2 + _2bz * q0) * fby +
+                      (_2bx * q3 - _4bz * q1) * fbz;
+    const double s2 = -_2q0 * fgx + _2q3 * fgy - 2 * _2q2 * fgz +
+                      (-_4bx * q2 - _2bz * q0) * fbx +
+                      (_2bx * q1 + _2bz * q3) * fby +
+                      (_2bx * q0 - _4bz * q2) * fbz;
+    const double s3 = _2q1 * fgx + _2q2 * fgy +
+                      (-_4bx * q3 + _2bz * q1) * fbx +
+                      (-_2bx * q0 + _2bz * q2) * fby + _2bx * q1 * fbz;
+
+    const Quaternion step(s1, s2, s3, s0);
+    if (step.norm_squared() > 0) {
+        q_dot = q_dot - step.normalize() * _beta;
+    }
+
+    return (orientation + q_dot * time_delta).normalize();
+}
+
+/**
+ * Mahony Filter
+ */
+SimpleSlam::Math::MahonyFilter::MahonyFilter(double kp, double ki)
+    : _kp{kp}, _ki{ki} {}
+
+SimpleSlam::Math::Quaternion SimpleSlam::Math::MahonyFilter::update(
+    const Quaternion& orientation, const Vector3& angular_velocity,
+    const Vector3& force, const Vector3& magno, double time_delta) {
+    if (force.dot(force) == 0 || magno.dot(magno) == 0) {
+        return Integrate_Gyro(orientation, angular_velocity, time_delta);
+    }
+
+    const Vector3 a = force.normalize();
+    const Vector3 m = magno.normalize();
+
+    // Earth field in the world frame, flattened onto the x-z plane so only
+    // inclination is kept
+    const Vector3 h = orientation.rotate(m);
+    const Vector3 b(sqrt(h[0] * h[0] + h[1] * h[1]), 0, h[2]);
+
+    // Predicted gravity and field directions in the body frame
+    const Vector3 v = orientation.rotate_inverse(Vector3(0, 0, 1));
+    const Vector3 w = orientation.rotate_inverse(b);
+
+    // Error is the rotation taking the predictions onto the measurements
+    const Vector3 error = a.cross(v) + m.cross(w);
+
+    Vector3 corrected = angular_velocity + error * _kp;
+    if (_ki > 0) {
+        _integral_error = _integral_error + error * (_ki * time_delta);
+        corrected = corrected + _integral_error;
+    }
+
+    return Integrate_Gyro(orientation, corrected, time_delta);
+}
@@ -0,0 +1,20 @@
+#include "math/sample_block.h"
+
+// CMSIS-DSP is optional, without it the plain loops are left for the
+// compiler to vectorize.
+#if defined(__has_include)
+#if __has_include("arm_math.h")
+#include "arm_math.h"
+#define SAMPLE_BLOCK_USE_CMSIS_DSP
+#endif
+#endif
+
+void SimpleSlam::Math::Scale_Array(float* values, size_t count, float scale) {
+#ifdef SAMPLE_BLOCK_USE_CMSIS_DSP
+    arm_scale_f32(values, scale, values, count);
+#else
+    for (size_t i = 0; i < count; i++) {
+        values[i] *= scale;
+    }
+#endif
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+/**
+ * Timing for the test_bench_* suites. On the board this reads the DWT cycle
+ * counter, on the host steady_clock nanoseconds. Suites include it as
+ * "../bench.h".
+*/
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __MBED__
+#include "mbed.h"
+
+#define BENCH_UNIT "cycles"
+// Keeps a run well inside the 32-bit cycle counter (~53s at 80MHz)
+#define BENCH_ITERATIONS 2000
+
+typedef uint32_t bench_ticks_t;
+
+static inline void Bench_Init() {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static inline bench_ticks_t Bench_Now() { return DWT->CYCCNT; }
+#else
+#include <chrono>
+
+#define BENCH_UNIT "ns"
+#define BENCH_ITERATIONS 200000
+
+typedef uint64_t bench_ticks_t;
+
+static inline void Bench_Init() {}
+
+static inline bench_ticks_t Bench_Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+#endif
+
+/** Ticks since start, unsigned so a counter wrap still subtracts right */
+static inline bench_ticks_t Bench_Elapsed(bench_ticks_t start) {
+    return Bench_Now() - start;
+}
+
+static inline double Bench_Report(const char* name, bench_ticks_t ticks,
+                                  uint32_t iterations,
+                                  const char* per = "update") {
+    const double per_iteration = (double)ticks / iterations;
+    printf("%-32s %10.1f " BENCH_UNIT "/%s\n", name, per_iteration, per);
+    return per_iteration;
+}
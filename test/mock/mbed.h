@@ -0,0 +1,111 @@
+/**
+ * Host stand-in for the parts of mbed OS used by the code under test.
+ * Everything runs on one thread, so critical sections are no-ops and
+ * EventFlags never blocks.
+*/
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <functional>
+
+#include "stm32l4xx_hal.h"
+
+namespace Mock_HAL {
+inline uint32_t us_ticks = 0;
+}
+
+inline uint32_t us_ticker_read() { return Mock_HAL::us_ticks; }
+
+inline void core_util_critical_section_enter() {}
+inline void core_util_critical_section_exit() {}
+
+namespace mbed {
+
+template <typename F>
+class Callback;
+
+template <typename R, typename... ArgTs>
+class Callback<R(ArgTs...)> {
+   public:
+    Callback() = default;
+    Callback(std::nullptr_t) {}
+    template <typename F>
+    Callback(F f) : _f{f} {}
+
+    R operator()(ArgTs... args) const { return _f(args...); }
+    explicit operator bool() const { return (bool)_f; }
+
+   private:
+    std::function<R(ArgTs...)> _f;
+};
+
+template <typename R, typename T, typename U>
+Callback<R()> callback(R (*f)(T*), U* arg) {
+    return Callback<R()>([=] { return f(arg); });
+}
+
+template <typename T, uint32_t N>
+class CircularBuffer {
+   public:
+    void push(const T& value) {
+        _values[(_head + _count) % N] = value;
+        if (_count < N) {
+            _count++;
+        } else {
+            _head = (_head + 1) % N;
+        }
+    }
+    bool pop(T& value) {
+        if (_count == 0) {
+            return false;
+        }
+        value = _values[_head];
+        _head = (_head + 1) % N;
+        _count--;
+        return true;
+    }
+    bool empty() const { return _count == 0; }
+    bool full() const { return _count == N; }
+    uint32_t size() const { return _count; }
+
+   private:
+    T _values[N] = {};
+    uint32_t _head = 0;
+    uint32_t _count = 0;
+};
+
+}  // namespace mbed
+
+namespace rtos {
+
+#define osFlagsErrorTimeout 0xFFFFFFFEU
+
+class EventFlags {
+   public:
+    uint32_t set(uint32_t flags) { return _flags |= flags; }
+    uint32_t clear(uint32_t flags = 0x7FFFFFFF) {
+        uint32_t previous = _flags;
+        _flags &= ~flags;
+        return previous;
+    }
+    uint32_t get() const { return _flags; }
+    uint32_t wait_all(uint32_t flags, uint32_t = 0xFFFFFFFF, bool clear = true) {
+        if ((_flags & flags) != flags) {
+            return osFlagsErrorTimeout;
+        }
+        if (clear) {
+            _flags &= ~flags;
+        }
+        return flags;
+    }
+
+   private:
+    uint32_t _flags = 0;
+};
+
+}  // namespace rtos
+
+using namespace mbed;
+using namespace rtos;
@@ -0,0 +1,193 @@
+/**
+ * Host stand-in for the STM32L4 HAL, covering what the drivers under test
+ * use. DMA transfers are recorded instead of started, the test finishes them
+ * with Mock_HAL::Complete_Transfer or Mock_HAL::Fail_Transfer.
+*/
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+typedef enum {
+    HAL_OK = 0x00,
+    HAL_ERROR = 0x01,
+    HAL_BUSY = 0x02,
+    HAL_TIMEOUT = 0x03,
+} HAL_StatusTypeDef;
+
+typedef enum {
+    HAL_I2C_STATE_RESET = 0x00,
+    HAL_I2C_STATE_READY = 0x20,
+    HAL_I2C_STATE_BUSY = 0x24,
+} HAL_I2C_StateTypeDef;
+
+typedef enum {
+    DMA1_Channel4_IRQn = 14,
+    DMA1_Channel5_IRQn = 15,
+    I2C2_EV_IRQn = 33,
+    I2C2_ER_IRQn = 34,
+    IRQ_COUNT = 35,
+} IRQn_Type;
+
+typedef struct {
+    uint32_t Request, Direction, PeriphInc, MemInc, PeriphDataAlignment,
+        MemDataAlignment, Mode, Priority;
+} DMA_InitTypeDef;
+typedef struct {
+    uint32_t id;
+} DMA_Channel_TypeDef;
+typedef struct {
+    DMA_Channel_TypeDef* Instance;
+    DMA_InitTypeDef Init;
+    void* Parent;
+} DMA_HandleTypeDef;
+
+typedef struct {
+    uint32_t Timing;
+} I2C_InitTypeDef;
+typedef struct {
+    I2C_InitTypeDef Init;
+    uint32_t ErrorCode;
+    HAL_I2C_StateTypeDef State;
+    DMA_HandleTypeDef* hdmatx;
+    DMA_HandleTypeDef* hdmarx;
+} I2C_HandleTypeDef;
+
+#define HAL_I2C_ERROR_NONE 0x00U
+#define HAL_I2C_ERROR_AF 0x04U
+#define I2C_MEMADD_SIZE_8BIT 0x01U
+
+#define DMA_REQUEST_3 3U
+#define DMA_PERIPH_TO_MEMORY 0x00U
+#define DMA_MEMORY_TO_PERIPH 0x10U
+#define DMA_PINC_DISABLE 0x00U
+#define DMA_MINC_ENABLE 0x80U
+#define DMA_PDATAALIGN_BYTE 0x00U
+#define DMA_MDATAALIGN_BYTE 0x00U
+#define DMA_NORMAL 0x00U
+#define DMA_PRIORITY_HIGH 0x2000U
+
+#define __HAL_RCC_DMA1_CLK_ENABLE() do {} while (0)
+#define __HAL_LINKDMA(handle, field, dma) \
+    do {                                  \
+        (handle)->field = &(dma);         \
+        (dma).Parent = (handle);          \
+    } while (0)
+
+namespace Mock_HAL {
+
+typedef struct {
+    bool is_read;
+    uint16_t peripheral_address;
+    uint16_t reg_address;
+    uint8_t* buffer;
+    uint16_t size;
+} dma_transfer_t;
+
+inline DMA_Channel_TypeDef dma1_channel4{4};
+inline DMA_Channel_TypeDef dma1_channel5{5};
+inline I2C_HandleTypeDef i2c_handle{};
+
+// Every DMA transfer started, oldest first
+inline std::vector<dma_transfer_t> transfers;
+// Returned by the next HAL_I2C_Mem_*_DMA call, then reset to HAL_OK
+inline HAL_StatusTypeDef next_start_status = HAL_OK;
+inline void (*vectors[IRQ_COUNT])() = {};
+inline bool irq_enabled[IRQ_COUNT] = {};
+inline uint32_t tick_ms = 0;
+
+inline HAL_StatusTypeDef start_transfer(bool is_read, uint16_t peripheral_address,
+                                        uint16_t reg_address, uint8_t* buffer,
+                                        uint16_t size) {
+    HAL_StatusTypeDef status = next_start_status;
+    next_start_status = HAL_OK;
+    if (status == HAL_OK) {
+        transfers.push_back({is_read, peripheral_address, reg_address, buffer, size});
+        i2c_handle.State = HAL_I2C_STATE_BUSY;
+    }
+    return status;
+}
+
+inline void Reset() {
+    i2c_handle = {};
+    i2c_handle.State = HAL_I2C_STATE_READY;
+    transfers.clear();
+    next_start_status = HAL_OK;
+    for (int i = 0; i < IRQ_COUNT; i++) {
+        vectors[i] = nullptr;
+        irq_enabled[i] = false;
+    }
+    tick_ms = 0;
+}
+
+}  // namespace Mock_HAL
+
+#define DMA1_Channel4 (&Mock_HAL::dma1_channel4)
+#define DMA1_Channel5 (&Mock_HAL::dma1_channel5)
+
+inline void NVIC_SetVector(IRQn_Type irq, uintptr_t vector) {
+    Mock_HAL::vectors[irq] = (void (*)())vector;
+}
+inline void NVIC_EnableIRQ(IRQn_Type irq) { Mock_HAL::irq_enabled[irq] = true; }
+inline void NVIC_DisableIRQ(IRQn_Type irq) { Mock_HAL::irq_enabled[irq] = false; }
+
+inline HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef*) { return HAL_OK; }
+inline HAL_StatusTypeDef HAL_DMA_DeInit(DMA_HandleTypeDef*) { return HAL_OK; }
+inline void HAL_DMA_IRQHandler(DMA_HandleTypeDef*) {}
+inline void HAL_I2C_EV_IRQHandler(I2C_HandleTypeDef*) {}
+inline void HAL_I2C_ER_IRQHandler(I2C_HandleTypeDef*) {}
+
+inline HAL_StatusTypeDef HAL_I2C_Mem_Read_DMA(I2C_HandleTypeDef*, uint16_t peripheral_address,
+                                              uint16_t reg_address, uint16_t,
+                                              uint8_t* buffer, uint16_t size) {
+    return Mock_HAL::start_transfer(true, peripheral_address, reg_address, buffer, size);
+}
+inline HAL_StatusTypeDef HAL_I2C_Mem_Write_DMA(I2C_HandleTypeDef*, uint16_t peripheral_address,
+                                               uint16_t reg_address, uint16_t,
+                                               uint8_t* buffer, uint16_t size) {
+    return Mock_HAL::start_transfer(false, peripheral_address, reg_address, buffer, size);
+}
+
+inline uint32_t HAL_I2C_GetError(I2C_HandleTypeDef* handle) { return handle->ErrorCode; }
+inline HAL_I2C_StateTypeDef HAL_I2C_GetState(I2C_HandleTypeDef* handle) { return handle->State; }
+
+// Every call advances the clock so polling loops run out
+inline uint32_t HAL_GetTick() { return Mock_HAL::tick_ms++; }
+
+extern "C" void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef* hi2c);
+extern "C" void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef* hi2c);
+
+namespace Mock_HAL {
+
+/**
+ * Finish the newest DMA transfer the way the HAL does, optionally filling the
+ * receive buffer first.
+*/
+inline void Complete_Transfer(const uint8_t* data = nullptr) {
+    const dma_transfer_t& transfer = transfers.back();
+    if (data != nullptr && transfer.is_read) {
+        for (uint16_t i = 0; i < transfer.size; i++) {
+            transfer.buffer[i] = data[i];
+        }
+    }
+    i2c_handle.State = HAL_I2C_STATE_READY;
+    if (transfer.is_read) {
+        HAL_I2C_MemRxCpltCallback(&i2c_handle);
+    } else {
+        HAL_I2C_MemTxCpltCallback(&i2c_handle);
+    }
+}
+
+/**
+ * Abort the newest DMA transfer with a NACK and raise the error interrupt
+*/
+inline void Fail_Transfer() {
+    i2c_handle.ErrorCode = HAL_I2C_ERROR_AF;
+    i2c_handle.State = HAL_I2C_STATE_READY;
+    vectors[I2C2_ER_IRQn]();
+    i2c_handle.ErrorCode = HAL_I2C_ERROR_NONE;
+}
+
+}  // namespace Mock_HAL
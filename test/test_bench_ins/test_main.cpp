@@ -0,0 +1,252 @@
+/**
+ * Cost of one strapdown update in float and double. The step is the
+ * STRAPDOWN/EULER path of InertialNavigationSystem::integrate with the
+ * complementary filter, run through the same templated code in both types.
+ * The double INS is timed alongside as the reference. Only the board numbers
+ * matter for the float switch, the M4F has a single precision FPU and does
+ * double in software.
+*/
+#include <math.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "../bench.h"
+#include "math/inertial_navigation.h"
+#include "math/orientation_filter.h"
+
+using namespace SimpleSlam::Math;
+
+#define TIME_DELTA (1 / 208.0)
+#define NUM_INPUTS 256
+
+/**
+ * INS strapdown step without the ZUPT window, generic over the scalar
+ */
+template <typename T>
+struct strapdown_t {
+    BasicQuaternion<T> q;
+    BasicVector3<T> accel_offset{0, 0, 1};
+    BasicVector3<T> velocity{0, 0, 0};
+    BasicVector3<T> position{0, 0, 0};
+
+    void update(const BasicVector3<T>& angular_velocity,
+                const BasicVector3<T>& force, const BasicVector3<T>& magno,
+                T time_delta) {
+        q = Complementary_Update(q, angular_velocity, force, magno, time_delta,
+                                 T(0.05));
+        const BasicVector3<T> world_accel =
+            (q.rotate(force) - accel_offset) * T(9.8);
+        velocity = velocity + world_accel * time_delta;
+        position = position + velocity * time_delta;
+    }
+};
+
+static std::vector<Vector3> angular_velocities;
+static std::vector<Vector3> forces;
+static std::vector<Vector3> magnos;
+
+/**
+ * Slow yaw with a rocking tilt and a fore-aft shake, enough to keep the
+ * |accel|^2 variance above the ZUPT threshold so the INS integrates motion
+ */
+static void make_inputs() {
+    angular_velocities.clear();
+    forces.clear();
+    magnos.clear();
+    for (int i = 0; i < NUM_INPUTS; i++) {
+        const double t = i * TIME_DELTA;
+        angular_velocities.push_back(Vector3(0.2 * sin(3 * t), 0.1, 0.5));
+        forces.push_back(Vector3(sin(40 * t), 0.1 * cos(3 * t), 1));
+        magnos.push_back(
+            Vector3(0.3 * cos(0.5 * t), -0.3 * sin(0.5 * t), -0.4));
+    }
+}
+
+template <typename T>
+static strapdown_t<T> run_strapdown(uint32_t iterations) {
+    std::vector<BasicVector3<T>> w, f, m;
+    for (int i = 0; i < NUM_INPUTS; i++) {
+        w.push_back(BasicVector3<T>(angular_velocities[i]));
+        f.push_back(BasicVector3<T>(forces[i]));
+        m.push_back(BasicVector3<T>(magnos[i]));
+    }
+
+    strapdown_t<T> ins;
+    for (uint32_t i = 0; i < iterations; i++) {
+        const int k = i % NUM_INPUTS;
+        ins.update(w[k], f[k], m[k], T(TIME_DELTA));
+    }
+    return ins;
+}
+
+void setUp(void) { make_inputs(); }
+
+void tearDown(void) {}
+
+/**
+ * Float has to track double over a second of data for the switch to be
+ * worth timing at all
+ */
+void test_float_tracks_double(void) {
+    const strapdown_t<double> d = run_strapdown<double>(208);
+    const strapdown_t<float> f = run_strapdown<float>(208);
+
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, d.q.x(), f.q.x());
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, d.q.y(), f.q.y());
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, d.q.z(), f.q.z());
+    TEST_ASSERT_DOUBLE_WITHIN(1e-5, d.q.w(), f.q.w());
+    for (int axis = 0; axis < 3; axis++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, d.velocity[axis], f.velocity[axis]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-3, d.position[axis], f.position[axis]);
+    }
+}
+
+void test_bench_update_position(void) {
+    Bench_Init();
+
+    bench_ticks_t start = Bench_Now();
+    volatile double sink = run_strapdown<double>(BENCH_ITERATIONS).position[0];
+    const double double_cost =
+        Bench_Report("strapdown step (double)", Bench_Elapsed(start),
+                     BENCH_ITERATIONS);
+
+    start = Bench_Now();
+    sink = run_strapdown<float>(BENCH_ITERATIONS).position[0];
+    const double float_cost = Bench_Report(
+        "strapdown step (float)", Bench_Elapsed(start), BENCH_ITERATIONS);
+
+    InertialNavigationSystem ins(TIME_DELTA, Vector3(1, 0, 0),
+                                 Vector3(0, 0, 1), Vector3(0, 0, 0),
+                                 Vector3(0, 0, 0), Vector3(0, 0, 0));
+    start = Bench_Now();
+    for (uint32_t i = 0; i < BENCH_ITERATIONS; i++) {
+        const int k = i % NUM_INPUTS;
+        ins.add_sample(forces[k] * 9.8);
+        ins.update_position(angular_velocities[k], forces[k], magnos[k]);
+    }
+    Bench_Report("INS update_position (double)", Bench_Elapsed(start),
+                 BENCH_ITERATIONS);
+    sink = ins.get_position()[0];
+    (void)sink;
+
+    printf("double / float: %.2f\n", double_cost / float_cost);
+    TEST_ASSERT_TRUE(double_cost > 0 && float_cost > 0);
+}
+
+/**
+ * Stop-go drive north on a level board: 2s at rest, then 2s covering 1m with
+ * a vertical shake on top so the ZUPT detector sees the motion. The gyro
+ * and accel carry biases the INS was not calibrated for.
+ */
+#define DRIVE_CYCLES 5
+#define REST_SAMPLES 416
+#define MOVE_SAMPLES 416
+
+static const Vector3 DRIVE_GYRO_BIAS(0.004, -0.006, 0.005);  // rad/s
+static const Vector3 DRIVE_ACCEL_BIAS(0.02, -0.015, 0.01);   // g
+static const Vector3 DRIVE_FIELD(0.2, 0, -0.4);
+
+typedef struct {
+    std::vector<Vector3> angular_velocities;
+    std::vector<Vector3> forces;
+    Vector3 final_position{0, 0, 0};
+} drive_t;
+
+static drive_t make_drive() {
+    const double move_time = MOVE_SAMPLES * TIME_DELTA;
+    const double distance = 1;
+    // sin bump acceleration integrating to distance over move_time
+    const double peak_accel = 2 * M_PI * distance / (move_time * move_time);
+    // 10Hz vertical shake, a whole number of periods per move
+    const double shake = 2;
+    const double shake_rate = 2 * M_PI * 10;
+
+    drive_t drive;
+    for (int cycle = 0; cycle < DRIVE_CYCLES; cycle++) {
+        for (int i = 0; i < REST_SAMPLES + MOVE_SAMPLES; i++) {
+            Vector3 accel(0, 0, 0);
+            if (i >= REST_SAMPLES) {
+                const double t = (i - REST_SAMPLES) * TIME_DELTA;
+                accel = Vector3(peak_accel * sin(2 * M_PI * t / move_time), 0,
+                                shake * cos(shake_rate * t));
+            }
+            drive.angular_velocities.push_back(DRIVE_GYRO_BIAS);
+            drive.forces.push_back(accel / 9.8 + Vector3(0, 0, 1) +
+                                   DRIVE_ACCEL_BIAS);
+        }
+        drive.final_position =
+            drive.final_position + Vector3(distance, 0, 0);
+    }
+    return drive;
+}
+
+/**
+ * Run the drive through an INS calibrated at rest with no gyro offset,
+ * returning the cost per update
+ */
+static double run_drive(const drive_t& drive, NavigationMode mode,
+                        const char* name, Vector3& position) {
+    // Level and facing north throughout
+    const Vector3 magno = DRIVE_FIELD;
+    InertialNavigationSystem ins(TIME_DELTA, Vector3(1, 0, 0),
+                                 drive.forces[0], Vector3(0, 0, 0),
+                                 Vector3(0, 0, 0), Vector3(0, 0, 0));
+    ins.align(drive.forces[0], magno);
+    ins.set_navigation_mode(mode);
+
+    Bench_Init();
+    const bench_ticks_t start = Bench_Now();
+    for (size_t i = 0; i < drive.forces.size(); i++) {
+        ins.add_sample(drive.forces[i] * 9.8);
+        ins.update_position(drive.angular_velocities[i], drive.forces[i],
+                            magno);
+    }
+    const double cost =
+        Bench_Report(name, Bench_Elapsed(start), drive.forces.size());
+    position = ins.get_position();
+    return cost;
+}
+
+/**
+ * Position accuracy against cost of the two navigation modes on the same
+ * drive. Strapdown's complementary filter pulls the forward acceleration
+ * into tilt, so it mostly loses the motion, the error-state filter keeps
+ * it but pays for the 15x15 covariance every sample. Drift times cost is
+ * what main's choice of mode turns on, the board numbers decide it.
+ */
+void test_bench_strapdown_vs_error_state(void) {
+    const drive_t drive = make_drive();
+
+    Vector3 strapdown_position(0, 0, 0);
+    const double strapdown_cost = run_drive(
+        drive, NavigationMode::STRAPDOWN, "drive strapdown", strapdown_position);
+    Vector3 error_state_position(0, 0, 0);
+    const double error_state_cost =
+        run_drive(drive, NavigationMode::ERROR_STATE_KALMAN,
+                  "drive error-state", error_state_position);
+
+    const double strapdown_drift =
+        (strapdown_position - drive.final_position).magnitude();
+    const double error_state_drift =
+        (error_state_position - drive.final_position).magnitude();
+    printf("drift over %dm: strapdown %.3fm, error-state %.3fm\n",
+           DRIVE_CYCLES, strapdown_drift, error_state_drift);
+    printf("error-state / strapdown: cost %.2f, drift %.2f, "
+           "drift x cost %.2f\n",
+           error_state_cost / strapdown_cost,
+           error_state_drift / strapdown_drift,
+           (error_state_drift * error_state_cost) /
+               (strapdown_drift * strapdown_cost));
+
+    TEST_ASSERT_TRUE(strapdown_cost > 0 && error_state_cost > 0);
+    TEST_ASSERT_TRUE(error_state_drift < strapdown_drift);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_float_tracks_double);
+    RUN_TEST(test_bench_update_position);
+    RUN_TEST(test_bench_strapdown_vs_error_state);
+    return UNITY_END();
+}
@@ -0,0 +1,1061 @@
+#pragma once
+
+/**
+ * Synthetic IMU log written by make_imu_log.py, not a recording.
+ * See the script for the motion and the noise model.
+*/
+#include <stdint.h>
+
+#define IMU_LOG_RATE_HZ 104
+#define IMU_LOG_REST_SAMPLES 208
+
+typedef struct {
+    uint32_t timestamp_us;
+    int16_t gyro[3];       // mdps
+    int16_t accel[3];      // mg
+    int16_t magno[3];      // mgauss
+    int16_t truth[4];      // x, y, z, w * 10000
+} imu_log_entry_t;
+
+static const imu_log_entry_t IMU_LOG[] = {
+    {0, 407, -164, 266, -1, -1, 1000, 197, 7, -399, 0, 0, 0, 10000},
+    {9615, 374, -236, 332, 5, 0, 1001, 200, -4, -401, 0, 0, 0, 10000},
+    {19231, 374, -344, 265, -4, 0, 1000, 209, -5, -399, 0, 0, 0, 10000},
+    {28846, 401, -317, 312, 5, 2, 1003, 204, 6, -393, 0, 0, 0, 10000},
+    {38462, 446, -195, 314, 1, -2, 1006, 208, 4, -394, 0, 0, 0, 10000},
+    {48077, 452, -218, 227, 1, -4, 1003, 192, -6, -397, 0, 0, 0, 10000},
+    {57692, 432, -283, 314, -7, -1, 993, 201, -3, -405, 0, 0, 0, 10000},
+    {67308, 362, -204, 270, 4, 6, 999, 193, -1, -399, 0, 0, 0, 10000},
+    {76923, 419, -280, 299, 6, -3, 996, 209, 3, -399, 0, 0, 0, 10000},
+    {86538, 467, -291, 160, -7, 0, 995, 206, -6, -401, 0, 0, 0, 10000},
+    {96154, 521, -330, 282, 1, -5, 999, 202, -6, -406, 0, 0, 0, 10000},
+    {105769, 404, -295, 211, 0, -2, 1001, 204, 0, -403, 0, 0, 0, 10000},
+    {115385, 274, -403, 263, -5, 3, 1004, 194, 3, -398, 0, 0, 0, 10000},
+    {125000, 434, -284, 334, -1, -5, 1008, 203, -6, -397, 0, 0, 0, 10000},
+    {134615, 431, -346, 346, -4, 1, 997, 200, -4, -396, 0, 0, 0, 10000},
+    {144231, 367, -300, 211, 2, -6, 999, 198, -5, -395, 0, 0, 0, 10000},
+    {153846, 348, -134, 286, 3, 0, 999, 197, 3, -401, 0, 0, 0, 10000},
+    {163462, 485, -301, 262, -2, 3, 999, 207, -4, -403, 0, 0, 0, 10000},
+    {173077, 413, -42, 350, 6, -1, 1005, 200, -4, -398, 0, 0, 0, 10000},
+    {182692, 502, -208, 274, -6, 0, 1002, 194, -3, -395, 0, 0, 0, 10000},
+    {192308, 337, -195, 367, -2, -2, 1003, 199, 2, -396, 0, 0, 0, 10000},
+    {201923, 350, -273, 213, -5, -1, 996, 201, 6, -403, 0, 0, 0, 10000},
+    {211538, 384, -232, 425, -5, 8, 999, 196, -1, -400, 0, 0, 0, 10000},
+    {221154, 555, -187, 384, -4, -5, 1002, 192, -2, -397, 0, 0, 0, 10000},
+    {230769, 445, -153, 294, -1, -5, 1006, 206, -1, -401, 0, 0, 0, 10000},
+    {240385, 361, -347, 374, 0, 1, 996, 211, 4, -396, 0, 0, 0, 10000},
+    {250000, 352, -279, 360, 6, -3, 997, 197, 7, -404, 0, 0, 0, 10000},
+    {259615, 425, -271, 439, 4, 9, 993, 196, -7, -401, 0, 0, 0, 10000},
+    {269231, 390, -228, 236, 5, 4, 1004, 194, 5, -395, 0, 0, 0, 10000},
+    {278846, 488, -242, 408, -5, 9, 999, 196, -2, -401, 0, 0, 0, 10000},
+    {288462, 374, -330, 331, -12, -3, 1002, 201, -3, -402, 0, 0, 0, 10000},
+    {298077, 416, -190, 289, 1, 1, 998, 196, -6, -391, 0, 0, 0, 10000},
+    {307692, 376, -241, 299, -7, -5, 1005, 197, 5, -402, 0, 0, 0, 10000},
+    {317308, 472, -328, 328, -2, 3, 1003, 197, -2, -404, 0, 0, 0, 10000},
+    {326923, 372, -222, 343, 9, -2, 997, 204, -4, -398, 0, 0, 0, 10000},
+    {336538, 291, -203, 323, -4, -5, 993, 201, 6, -402, 0, 0, 0, 10000},
+    {346154, 323, -214, 201, -2, 6, 1001, 196, 2, -397, 0, 0, 0, 10000},
+    {355769, 477, -220, 210, -1, 9, 1008, 198, -8, -399, 0, 0, 0, 10000},
+    {365385, 453, -130, 353, 3, -7, 998, 199, -2, -398, 0, 0, 0, 10000},
+    {375000, 509, -328, 229, -4, 0, 1001, 203, -1, -400, 0, 0, 0, 10000},
+    {384615, 391, -315, 335, 5, -2, 993, 199, 1, -407, 0, 0, 0, 10000},
+    {394231, 392, -261, 266, 5, -1, 1000, 196, 1, -396, 0, 0, 0, 10000},
+    {403846, 325, -154, 242, 2, -6, 1000, 201, -2, -399, 0, 0, 0, 10000},
+    {413462, 393, -252, 287, 9, 3, 1007, 201, 2, -402, 0, 0, 0, 10000},
+    {423077, 367, -303, 314, -6, 3, 999, 200, -2, -394, 0, 0, 0, 10000},
+    {432692, 343, -307, 220, -7, -6, 996, 202, -2, -397, 0, 0, 0, 10000},
+    {442308, 301, -307, 273, -5, -1, 998, 197, -2, -399, 0, 0, 0, 10000},
+    {451923, 481, -205, 293, -4, 0, 998, 204, -6, -407, 0, 0, 0, 10000},
+    {461538, 305, -261, 441, 8, 4, 995, 202, 1, -400, 0, 0, 0, 10000},
+    {471154, 307, -210, 383, -1, 7, 1000, 193, -3, -391, 0, 0, 0, 10000},
+    {480769, 475, -252, 270, 1, -9, 1000, 199, 7, -396, 0, 0, 0, 10000},
+    {490385, 283, -260, 292, -3, 1, 998, 203, -5, -396, 0, 0, 0, 10000},
+    {500000, 490, -205, 332, 3, 5, 996, 198, 6, -397, 0, 0, 0, 10000},
+    {509615, 338, -285, 380, -4, -4, 999, 198, -4, -398, 0, 0, 0, 10000},
+    {519231, 414, -269, 353, 1, 2, 1006, 200, 3, -400, 0, 0, 0, 10000},
+    {528846, 482, -175, 283, 0, 4, 1004, 201, 1, -406, 0, 0, 0, 10000},
+    {538462, 370, -164, 132, -3, -5, 1001, 197, 8, -404, 0, 0, 0, 10000},
+    {548077, 428, -154, 274, -1, 2, 1003, 199, -3, -398, 0, 0, 0, 10000},
+    {557692, 362, -257, 462, -3, -3, 997, 204, 2, -401, 0, 0, 0, 10000},
+    {567308, 335, -243, 263, -6, 6, 995, 203, 0, -396, 0, 0, 0, 10000},
+    {576923, 316, -208, 196, -2, -1, 994, 202, -2, -399, 0, 0, 0, 10000},
+    {586538, 283, -194, 321, 1, 2, 1005, 198, 4, -390, 0, 0, 0, 10000},
+    {596154, 489, -322, 331, 5, -2, 1001, 190, 11, -393, 0, 0, 0, 10000},
+    {605769, 426, -196, 358, 5, -6, 1007, 201, 1, -397, 0, 0, 0, 10000},
+    {615385, 491, -268, 364, 0, 3, 1001, 203, 0, -405, 0, 0, 0, 10000},
+    {625000, 346, -147, 271, 2, 5, 1004, 201, -5, -400, 0, 0, 0, 10000},
+    {634615, 450, -306, 236, 3, 2, 1003, 199, 4, -401, 0, 0, 0, 10000},
+    {644231, 500, -362, 252, 1, 1, 996, 205, -6, -400, 0, 0, 0, 10000},
+    {653846, 329, -166, 205, 2, 2, 991, 197, 0, -397, 0, 0, 0, 10000},
+    {663462, 342, -280, 244, -6, 1, 1004, 201, 5, -404, 0, 0, 0, 10000},
+    {673077, 389, -180, 249, -3, -3, 999, 206, 5, -400, 0, 0, 0, 10000},
+    {682692, 481, -449, 369, 1, -1, 998, 198, 1, -395, 0, 0, 0, 10000},
+    {692308, 417, -257, 237, 10, -5, 1002, 201, -1, -400, 0, 0, 0, 10000},
+    {701923, 295, -260, 197, 2, -3, 1004, 202, -5, -397, 0, 0, 0, 10000},
+    {711538, 326, -304, 363, 5, -2, 995, 209, -4, -402, 0, 0, 0, 10000},
+    {721154, 461, -211, 293, 8, -2, 999, 208, 7, -405, 0, 0, 0, 10000},
+    {730769, 430, -367, 237, -3, 0, 998, 200, -3, -401, 0, 0, 0, 10000},
+    {740385, 289, -278, 165, 2, -6, 1002, 207, 8, -401, 0, 0, 0, 10000},
+    {750000, 446, -351, 291, 4, 1, 1001, 200, 7, -395, 0, 0, 0, 10000},
+    {759615, 441, -233, 262, -2, 0, 1002, 200, 1, -396, 0, 0, 0, 10000},
+    {769231, 339, -200, 273, 9, 5, 1005, 201, -3, -392, 0, 0, 0, 10000},
+    {778846, 320, -273, 347, -5, 2, 1004, 198, 7, -394, 0, 0, 0, 10000},
+    {788462, 434, -290, 334, 5, -4, 1001, 198, 6, -393, 0, 0, 0, 10000},
+    {798077, 481, -188, 366, -1, 3, 997, 201, 0, -405, 0, 0, 0, 10000},
+    {807692, 435, -228, 241, 1, 2, 1000, 204, 2, -405, 0, 0, 0, 10000},
+    {817308, 394, -306, 343, 1, 8, 998, 202, 1, -398, 0, 0, 0, 10000},
+    {826923, 420, -304, 343, 3, 1, 999, 199, 6, -398, 0, 0, 0, 10000},
+    {836538, 445, -259, 274, 0, -7, 997, 198, 3, -397, 0, 0, 0, 10000},
+    {846154, 429, -329, 328, 3, 4, 1007, 199, 3, -390, 0, 0, 0, 10000},
+    {855769, 376, -252, 303, 1, -1, 1004, 206, 6, -403, 0, 0, 0, 10000},
+    {865385, 459, -295, 247, 3, 1, 994, 194, -2, -399, 0, 0, 0, 10000},
+    {875000, 396, -207, 360, -3, -4, 1004, 197, 4, -406, 0, 0, 0, 10000},
+    {884615, 458, -336, 226, 0, -2, 996, 199, -9, -397, 0, 0, 0, 10000},
+    {894231, 364, -343, 226, 0, 2, 997, 200, 5, -400, 0, 0, 0, 10000},
+    {903846, 484, -188, 273, 7, 5, 998, 202, 0, -404, 0, 0, 0, 10000},
+    {913462, 325, -368, 300, 9, -4, 1001, 199, -2, -407, 0, 0, 0, 10000},
+    {923077, 308, -340, 196, 1, 8, 998, 193, -8, -400, 0, 0, 0, 10000},
+    {932692, 463, -266, 308, -6, -2, 1001, 196, -6, -395, 0, 0, 0, 10000},
+    {942308, 406, -333, 312, -3, -2, 1006, 198, -4, -401, 0, 0, 0, 10000},
+    {951923, 235, -265, 262, -3, -10, 1007, 194, 2, -403, 0, 0, 0, 10000},
+    {961538, 495, -349, 305, 2, -4, 1000, 199, -10, -394, 0, 0, 0, 10000},
+    {971154, 456, -153, 265, -3, -2, 998, 200, 3, -393, 0, 0, 0, 10000},
+    {980769, 311, -214, 194, 1, -1, 999, 210, 2, -396, 0, 0, 0, 10000},
+    {990385, 420, -149, 292, -4, 4, 1005, 202, 2, -403, 0, 0, 0, 10000},
+    {1000000, 462, -318, 235, -3, -3, 999, 200, -5, -399, 0, 0, 0, 10000},
+    {1009615, 433, -223, 293, 0, 6, 1007, 195, -1, -400, 0, 0, 0, 10000},
+    {1019231, 531, -287, 427, -2, -3, 996, 196, 3, -395, 0, 0, 0, 10000},
+    {1028846, 453, -226, 278, 3, 1, 1004, 201, -2, -403, 0, 0, 0, 10000},
+    {1038462, 464, -288, 353, -2, -7, 1003, 203, 0, -399, 0, 0, 0, 10000},
+    {1048077, 466, -161, 288, 0, -3, 1003, 200, -2, -396, 0, 0, 0, 10000},
+    {1057692, 421, -132, 374, 0, -1, 995, 205, -3, -396, 0, 0, 0, 10000},
+    {1067308, 517, -230, 215, 2, -4, 995, 199, 4, -396, 0, 0, 0, 10000},
+    {1076923, 393, -263, 277, 1, -5, 998, 197, 0, -409, 0, 0, 0, 10000},
+    {1086538, 357, -229, 332, -1, 0, 1000, 195, -3, -399, 0, 0, 0, 10000},
+    {1096154, 444, -300, 366, 0, 5, 999, 201, 2, -407, 0, 0, 0, 10000},
+    {1105769, 435, -223, 199, 1, 4, 1005, 206, -11, -396, 0, 0, 0, 10000},
+    {1115385, 517, -339, 213, 2, 1, 995, 200, -3, -398, 0, 0, 0, 10000},
+    {1125000, 310, -130, 380, -4, 2, 999, 205, 1, -397, 0, 0, 0, 10000},
+    {1134615, 335, -274, 279, -4, -2, 998, 203, 1, -407, 0, 0, 0, 10000},
+    {1144231, 435, -153, 325, 0, -1, 1003, 198, 1, -397, 0, 0, 0, 10000},
+    {1153846, 326, -136, 272, 3, -3, 998, 205, -4, -403, 0, 0, 0, 10000},
+    {1163462, 404, -324, 300, 5, 0, 1003, 199, -2, -403, 0, 0, 0, 10000},
+    {1173077, 324, -316, 340, 0, -1, 996, 196, 5, -396, 0, 0, 0, 10000},
+    {1182692, 333, -266, 215, -3, -5, 997, 193, 13, -404, 0, 0, 0, 10000},
+    {1192308, 415, -331, 319, 1, 0, 1000, 196, 2, -391, 0, 0, 0, 10000},
+    {1201923, 411, -242, 356, 2, 0, 1000, 201, 6, -405, 0, 0, 0, 10000},
+    {1211538, 410, -196, 139, -4, 1, 995, 198, 1, -397, 0, 0, 0, 10000},
+    {1221154, 323, -307, 292, -2, 1, 992, 196, -1, -395, 0, 0, 0, 10000},
+    {1230769, 329, -298, 272, -3, 5, 1000, 204, 1, -397, 0, 0, 0, 10000},
+    {1240385, 342, -190, 232, 1, -1, 1003, 199, 9, -399, 0, 0, 0, 10000},
+    {1250000, 311, -220, 214, 5, 4, 997, 210, -2, -398, 0, 0, 0, 10000},
+    {1259615, 476, -292, 344, -3, 3, 1001, 200, 8, -406, 0, 0, 0, 10000},
+    {1269231, 378, -263, 263, -5, -1, 1002, 204, -3, -400, 0, 0, 0, 10000},
+    {1278846, 541, -181, 353, 5, -1, 999, 201, 0, -400, 0, 0, 0, 10000},
+    {1288462, 448, -97, 387, 0, -7, 1003, 198, -11, -404, 0, 0, 0, 10000},
+    {1298077, 461, -205, 350, -1, 2, 998, 199, -2, -408, 0, 0, 0, 10000},
+    {1307692, 460, -368, 323, -4, -2, 998, 206, 1, -405, 0, 0, 0, 10000},
+    {1317308, 510, -164, 351, 3, -3, 999, 206, -1, -392, 0, 0, 0, 10000},
+    {1326923, 333, -401, 281, 2, -3, 998, 208, 4, -395, 0, 0, 0, 10000},
+    {1336538, 442, -379, 418, -10, -7, 995, 196, 1, -403, 0, 0, 0, 10000},
+    {1346154, 400, -341, 423, -1, -9, 1005, 192, -4, -401, 0, 0, 0, 10000},
+    {1355769, 285, -146, 164, -4, -5, 1004, 201, -2, -404, 0, 0, 0, 10000},
+    {1365385, 505, -330, 383, -5, -3, 1004, 199, 2, -401, 0, 0, 0, 10000},
+    {1375000, 494, -315, 234, 5, -2, 1002, 201, 1, -397, 0, 0, 0, 10000},
+    {1384615, 373, -398, 254, -6, 0, 1001, 199, -8, -402, 0, 0, 0, 10000},
+    {1394231, 278, -196, 308, 0, -1, 992, 196, 1, -405, 0, 0, 0, 10000},
+    {1403846, 409, -160, 378, 7, -4, 1003, 198, -4, -404, 0, 0, 0, 10000},
+    {1413462, 409, -280, 379, -2, 1, 1002, 200, -3, -397, 0, 0, 0, 10000},
+    {1423077, 361, -224, 273, 1, 3, 996, 195, 0, -401, 0, 0, 0, 10000},
+    {1432692, 434, -195, 294, -1, 3, 1000, 200, -8, -401, 0, 0, 0, 10000},
+    {1442308, 456, -225, 161, 5, -2, 1002, 203, -4, -397, 0, 0, 0, 10000},
+    {1451923, 295, -358, 203, -2, -3, 1003, 208, 9, -398, 0, 0, 0, 10000},
+    {1461538, 404, -287, 336, -2, 2, 994, 202, 4, -398, 0, 0, 0, 10000},
+    {1471154, 371, -251, 135, 3, -2, 997, 204, -3, -398, 0, 0, 0, 10000},
+    {1480769, 476, -239, 246, 0, 2, 1007, 205, 0, -401, 0, 0, 0, 10000},
+    {1490385, 411, -117, 341, -8, 2, 1002, 195, 8, -401, 0, 0, 0, 10000},
+    {1500000, 365, -202, 335, 1, -7, 995, 205, 5, -403, 0, 0, 0, 10000},
+    {1509615, 325, -303, 353, 0, 0, 1001, 196, 2, -400, 0, 0, 0, 10000},
+    {1519231, 261, -262, 329, -7, -1, 993, 197, 0, -404, 0, 0, 0, 10000},
+    {1528846, 402, -168, 423, 4, 6, 1003, 191, 2, -402, 0, 0, 0, 10000},
+    {1538462, 351, -339, 317, -5, 2, 1001, 199, -1, -408, 0, 0, 0, 10000},
+    {1548077, 530, -345, 196, 1, 2, 1004, 202, -2, -399, 0, 0, 0, 10000},
+    {1557692, 448, -266, 341, -2, 5, 1003, 201, 2, -391, 0, 0, 0, 10000},
+    {1567308, 369, -241, 199, -7, -3, 1001, 205, 2, -404, 0, 0, 0, 10000},
+    {1576923, 313, -371, 453, -5, -3, 994, 200, -2, -407, 0, 0, 0, 10000},
+    {1586538, 423, -132, 259, -10, 6, 1001, 202, -2, -397, 0, 0, 0, 10000},
+    {1596154, 368, -190, 307, -4, -1, 996, 196, -1, -403, 0, 0, 0, 10000},
+    {1605769, 319, -383, 174, 5, 6, 1007, 200, -5, -400, 0, 0, 0, 10000},
+    {1615385, 379, -267, 226, -1, 4, 999, 200, -2, -403, 0, 0, 0, 10000},
+    {1625000, 433, -240, 213, 9, -2, 997, 199, -3, -396, 0, 0, 0, 10000},
+    {1634615, 391, -316, 315, -8, 3, 999, 198, 9, -398, 0, 0, 0, 10000},
+    {1644231, 437, -342, 313, 2, 0, 1000, 208, 4, -402, 0, 0, 0, 10000},
+    {1653846, 490, -302, 295, -1, 5, 991, 198, -3, -401, 0, 0, 0, 10000},
+    {1663462, 377, -152, 298, 3, 4, 995, 196, -4, -397, 0, 0, 0, 10000},
+    {1673077, 379, -297, 405, -1, 9, 999, 205, -2, -399, 0, 0, 0, 10000},
+    {1682692, 519, -326, 256, 1, -5, 998, 200, 1, -397, 0, 0, 0, 10000},
+    {1692308, 414, -199, 280, -5, -4, 998, 208, 4, -400, 0, 0, 0, 10000},
+    {1701923, 478, -230, 268, 7, 1, 994, 197, -2, -399, 0, 0, 0, 10000},
+    {1711538, 278, -215, 265, 0, -2, 1002, 198, -5, -402, 0, 0, 0, 10000},
+    {1721154, 334, -71, 357, -2, 1, 997, 194, 0, -399, 0, 0, 0, 10000},
+    {1730769, 375, -243, 311, -6, 2, 1000, 209, 4, -398, 0, 0, 0, 10000},
+    {1740385, 414, -258, 261, -1, 6, 1004, 200, 6, -394, 0, 0, 0, 10000},
+    {1750000, 424, -236, 147, 4, 4, 997, 202, -3, -399, 0, 0, 0, 10000},
+    {1759615, 280, -176, 194, -3, -7, 994, 198, -3, -404, 0, 0, 0, 10000},
+    {1769231, 391, -321, 256, 1, -1, 1005, 198, -4, -397, 0, 0, 0, 10000},
+    {1778846, 320, -211, 317, 8, -9, 1002, 193, -3, -397, 0, 0, 0, 10000},
+    {1788462, 471, -151, 288, 6, 4, 1005, 199, 3, -394, 0, 0, 0, 10000},
+    {1798077, 460, -268, 200, -1, -2, 1005, 201, -1, -402, 0, 0, 0, 10000},
+    {1807692, 559, -346, 174, -7, 1, 1004, 201, -5, -401, 0, 0, 0, 10000},
+    {1817308, 436, -324, 291, 7, -2, 995, 196, -7, -402, 0, 0, 0, 10000},
+    {1826923, 302, -283, 322, 3, -1, 1000, 204, 1, -403, 0, 0, 0, 10000},
+    {1836538, 423, -204, 313, -5, 1, 996, 195, 1, -404, 0, 0, 0, 10000},
+    {1846154, 436, -190, 282, -1, -3, 1002, 194, -3, -406, 0, 0, 0, 10000},
+    {1855769, 412, -255, 376, 2, -8, 1003, 200, 5, -401, 0, 0, 0, 10000},
+    {1865385, 416, -177, 392, -3, 2, 997, 197, 4, -397, 0, 0, 0, 10000},
+    {1875000, 458, -253, 386, 2, 0, 995, 195, -3, -397, 0, 0, 0, 10000},
+    {1884615, 476, -227, 343, -3, 8, 994, 197, 0, -398, 0, 0, 0, 10000},
+    {1894231, 351, -341, 330, -7, 0, 998, 205, 3, -407, 0, 0, 0, 10000},
+    {1903846, 496, -270, 215, 4, -11, 1002, 210, 4, -405, 0, 0, 0, 10000},
+    {1913462, 375, -294, 221, -2, -7, 995, 199, 6, -400, 0, 0, 0, 10000},
+    {1923077, 461, -314, 313, -1, 0, 1006, 200, -4, -407, 0, 0, 0, 10000},
+    {1932692, 496, -95, 182, -3, 2, 1002, 189, -5, -399, 0, 0, 0, 10000},
+    {1942308, 342, -192, 282, -2, -2, 1006, 210, -3, -410, 0, 0, 0, 10000},
+    {1951923, 364, -277, 268, -5, -6, 987, 197, 9, -394, 0, 0, 0, 10000},
+    {1961538, 425, -223, 173, 3, 0, 995, 199, -3, -400, 0, 0, 0, 10000},
+    {1971154, 334, -264, 275, 3, -6, 1000, 198, -1, -400, 0, 0, 0, 10000},
+    {1980769, 330, -307, 340, -4, -2, 1000, 200, 0, -398, 0, 0, 0, 10000},
+    {1990385, 319, -273, 253, 0, 5, 1001, 202, 6, -395, 0, 0, 0, 10000},
+    {2000000, 338, -60, 288, -3, 0, 1005, 202, 0, -404, 0, 0, 0, 10000},
+    {2009615, 654, -63, 414, 2, -4, 997, 195, -2, -404, 0, 0, 0, 10000},
+    {2019231, 613, 6, 484, -1, -2, 1004, 201, -1, -398, 0, 0, 0, 10000},
+    {2028846, 757, -45, 571, 6, 8, 1000, 196, -1, -398, 0, 1, 1, 10000},
+    {2038462, 701, -237, 950, -4, -9, 998, 198, 4, -393, 1, 1, 1, 10000},
+    {2048077, 866, -177, 881, 13, 1, 994, 200, -4, -410, 1, 1, 2, 10000},
+    {2057692, 960, -121, 1162, 16, -2, 1002, 202, -5, -400, 1, 1, 2, 10000},
+    {2067308, 999, -251, 1190, 7, -1, 997, 200, 1, -400, 2, 1, 3, 10000},
+    {2076923, 1040, -243, 1507, 13, 4, 1003, 203, -7, -407, 2, 1, 4, 10000},
+    {2086538, 1157, -239, 1508, 14, -1, 1003, 207, 2, -410, 3, 1, 5, 10000},
+    {2096154, 1208, -457, 1826, 21, -8, 996, 197, -1, -398, 4, 1, 6, 10000},
+    {2105769, 1294, -432, 1761, 18, 0, 1004, 192, 3, -398, 4, 1, 7, 10000},
+    {2115385, 1354, -372, 2059, 23, 5, 998, 199, 1, -398, 5, 1, 9, 10000},
+    {2125000, 1333, -561, 2126, 21, -1, 999, 202, 4, -406, 6, 0, 10, 10000},
+    {2134615, 1487, -494, 2356, 24, 2, 1000, 207, -5, -393, 7, 0, 12, 10000},
+    {2144231, 1613, -609, 2465, 24, 0, 1006, 193, -8, -405, 8, 0, 13, 10000},
+    {2153846, 1548, -667, 2536, 24, -3, 1004, 204, 2, -402, 9, 0, 15, 10000},
+    {2163462, 1408, -620, 2631, 26, 6, 1001, 209, -1, -402, 10, -1, 17, 10000},
+    {2173077, 1477, -677, 2849, 26, -3, 1003, 197, 2, -394, 10, -1, 19, 10000},
+    {2182692, 1646, -774, 3059, 32, 1, 994, 198, -1, -401, 11, -1, 21, 10000},
+    {2192308, 1380, -666, 3174, 28, 7, 1000, 198, -1, -403, 12, -2, 24, 10000},
+    {2201923, 1433, -991, 3272, 33, 4, 1003, 201, -3, -395, 13, -2, 26, 10000},
+    {2211538, 1489, -909, 3477, 34, 2, 994, 204, -4, -405, 14, -3, 29, 10000},
+    {2221154, 1460, -904, 3466, 32, 8, 1003, 196, -4, -404, 15, -3, 31, 10000},
+    {2230769, 1374, -886, 3614, 39, 6, 997, 198, 1, -398, 16, -4, 34, 10000},
+    {2240385, 1223, -1039, 3629, 46, -1, 1001, 200, 0, -404, 16, -4, 37, 10000},
+    {2250000, 1012, -919, 3827, 30, -3, 997, 200, -9, -397, 17, -5, 40, 10000},
+    {2259615, 1031, -932, 4102, 44, 9, 1001, 195, -5, -394, 18, -6, 43, 10000},
+    {2269231, 943, -1009, 4138, 44, -6, 996, 190, 4, -402, 18, -6, 46, 10000},
+    {2278846, 964, -973, 4256, 45, 8, 998, 200, -3, -399, 19, -7, 49, 10000},
+    {2288462, 628, -1054, 4380, 43, 4, 998, 194, -5, -398, 19, -8, 53, 10000},
+    {2298077, 679, -1132, 4488, 46, 5, 996, 198, -5, -400, 19, -8, 56, 10000},
+    {2307692, 527, -1014, 4661, 52, 6, 1000, 199, -5, -400, 20, -9, 60, 10000},
+    {2317308, 517, -962, 4765, 49, 6, 998, 195, 3, -404, 20, -10, 64, 10000},
+    {2326923, 384, -1146, 4925, 51, 5, 995, 198, -2, -407, 20, -11, 67, 10000},
+    {2336538, 271, -1211, 5180, 55, 6, 1001, 199, -1, -400, 20, -11, 71, 10000},
+    {2346154, -31, -1007, 5253, 61, -2, 998, 197, 5, -399, 20, -12, 75, 10000},
+    {2355769, -145, -1312, 5356, 56, 13, 1000, 202, -2, -400, 19, -13, 80, 10000},
+    {2365385, -203, -1182, 5388, 58, 0, 1002, 192, -8, -402, 19, -14, 84, 10000},
+    {2375000, -307, -1011, 5611, 63, 1, 999, 207, -6, -405, 18, -14, 88, 10000},
+    {2384615, -556, -976, 5629, 64, 5, 999, 201, -1, -401, 18, -15, 93, 10000},
+    {2394231, -730, -1041, 5834, 67, 2, 1006, 202, -6, -395, 17, -16, 97, 10000},
+    {2403846, -724, -994, 5949, 68, -3, 1002, 196, -9, -405, 16, -17, 102, 9999},
+    {2413462, -851, -1120, 6041, 65, -3, 1004, 199, -11, -400, 15, -17, 107, 9999},
+    {2423077, -1065, -1025, 6288, 63, 1, 1006, 199, -4, -400, 14, -18, 112, 9999},
+    {2432692, -1108, -973, 6348, 67, 1, 1000, 206, -8, -398, 12, -19, 117, 9999},
+    {2442308, -1291, -1024, 6413, 68, 2, 1000, 203, 1, -400, 11, -19, 122, 9999},
+    {2451923, -1396, -930, 6507, 69, 8, 998, 197, -9, -404, 9, -20, 127, 9999},
+    {2461538, -1437, -1027, 6674, 71, -2, 1008, 205, -6, -397, 8, -20, 132, 9999},
+    {2471154, -1763, -925, 6781, 81, 7, 1000, 202, -4, -401, 6, -21, 138, 9999},
+    {2480769, -1716, -841, 6980, 76, -6, 1000, 196, -7, -401, 4, -22, 143, 9999},
+    {2490385, -1845, -728, 7112, 87, 6, 1000, 200, -2, -405, 2, -22, 149, 9999},
+    {2500000, -2107, -646, 7138, 81, -2, 989, 191, -8, -400, 0, -23, 155, 9999},
+    {2509615, -2133, -714, 7303, 86, -3, 1005, 199, -5, -402, -2, -23, 160, 9999},
+    {2519231, -2118, -632, 7346, 78, 0, 1002, 199, -10, -401, -4, -23, 166, 9999},
+    {2528846, -2239, -568, 7442, 85, 6, 1003, 200, -1, -400, -6, -24, 172, 9998},
+    {2538462, -2308, -591, 7620, 95, -5, 998, 199, -10, -400, -8, -24, 178, 9998},
+    {2548077, -2226, -556, 7910, 83, 5, 1000, 195, -6, -402, -11, -24, 185, 9998},
+    {2557692, -2433, -386, 7833, 86, -2, 996, 195, -5, -405, -13, -25, 191, 9998},
+    {2567308, -2326, -348, 7933, 82, -6, 1002, 199, -6, -401, -15, -25, 197, 9998},
+    {2576923, -2449, -380, 8079, 82, -3, 998, 193, -7, -409, -18, -25, 204, 9998},
+    {2586538, -2382, -328, 8146, 85, -2, 997, 195, -8, -398, -20, -25, 210, 9998},
+    {2596154, -2495, -224, 8267, 93, 0, 997, 196, -9, -400, -22, -25, 217, 9998},
+    {2605769, -2397, -146, 8431, 92, -8, 1000, 195, -10, -394, -25, -25, 224, 9997},
+    {2615385, -2419, -39, 8698, 93, 2, 1002, 199, -7, -407, -27, -25, 231, 9997},
+    {2625000, -2251, -83, 8711, 96, -1, 1002, 192, -16, -402, -29, -25, 238, 9997},
+    {2634615, -2192, 40, 8814, 95, -3, 1002, 197, -8, -406, -31, -24, 245, 9997},
+    {2644231, -2006, 165, 8956, 102, -7, 999, 205, -7, -393, -34, -24, 252, 9997},
+    {2653846, -1960, 171, 8995, 102, -9, 1006, 201, -4, -399, -36, -24, 259, 9997},
+    {2663462, -1849, 302, 9223, 104, -9, 999, 189, -3, -403, -38, -23, 267, 9996},
+    {2673077, -1790, 256, 9292, 103, 0, 1000, 198, -15, -406, -39, -23, 274, 9996},
+    {2682692, -1621, 476, 9363, 101, -12, 1001, 205, -7, -401, -41, -22, 282, 9996},
+    {2692308, -1404, 574, 9529, 103, -3, 997, 197, -9, -408, -43, -22, 289, 9996},
+    {2701923, -1265, 555, 9732, 99, -9, 1003, 192, -4, -402, -44, -21, 297, 9995},
+    {2711538, -1097, 607, 9683, 101, -14, 999, 204, -13, -402, -46, -20, 305, 9995},
+    {2721154, -839, 682, 9913, 107, -8, 1006, 199, -10, -406, -47, -20, 313, 9995},
+    {2730769, -783, 781, 9882, 111, -10, 994, 203, -20, -407, -48, -19, 321, 9995},
+    {2740385, -556, 850, 10031, 103, -15, 999, 193, -11, -395, -49, -18, 329, 9994},
+    {2750000, -231, 864, 10125, 107, -6, 1001, 204, -14, -396, -50, -17, 337, 9994},
+    {2759615, -93, 1013, 10181, 110, -7, 1002, 196, -12, -400, -50, -16, 346, 9994},
+    {2769231, 154, 1187, 10421, 109, -24, 996, 192, -16, -401, -50, -15, 354, 9994},
+    {2778846, 350, 1061, 10518, 109, -15, 1001, 200, -12, -400, -51, -14, 363, 9993},
+    {2788462, 603, 1166, 10638, 112, -14, 1004, 194, -11, -403, -51, -12, 371, 9993},
+    {2798077, 902, 1413, 10692, 119, -18, 1004, 193, -10, -396, -50, -11, 380, 9993},
+    {2807692, 1143, 1383, 10912, 109, -18, 1001, 200, -7, -394, -50, -10, 389, 9992},
+    {2817308, 1329, 1365, 10947, 117, -8, 993, 201, -10, -393, -49, -8, 397, 9992},
+    {2826923, 1595, 1384, 11122, 118, -7, 999, 204, -9, -405, -48, -7, 406, 9992},
+    {2836538, 1910, 1548, 11078, 113, -9, 998, 199, -10, -391, -47, -5, 415, 9991},
+    {2846154, 2170, 1494, 11348, 119, -6, 993, 207, -15, -401, -46, -4, 424, 9991},
+    {2855769, 2338, 1465, 11426, 118, -5, 998, 199, -14, -406, -45, -2, 434, 9990},
+    {2865385, 2636, 1712, 11305, 123, 0, 998, 194, -16, -393, -43, -1, 443, 9990},
+    {2875000, 2868, 1584, 11553, 118, -8, 1003, 193, -17, -406, -41, 1, 452, 9990},
+    {2884615, 3129, 1688, 11533, 116, -7, 991, 201, -14, -399, -39, 3, 462, 9989},
+    {2894231, 3241, 1720, 11681, 119, -5, 998, 202, -12, -395, -37, 5, 471, 9989},
+    {2903846, 3494, 1817, 11787, 117, 0, 999, 204, -23, -400, -34, 6, 481, 9988},
+    {2913462, 3752, 1867, 12003, 118, -6, 997, 202, -17, -390, -32, 8, 491, 9988},
+    {2923077, 3882, 1767, 11898, 121, -10, 991, 201, -23, -400, -29, 10, 500, 9987},
+    {2932692, 3987, 1791, 12089, 118, -6, 997, 196, -19, -402, -26, 12, 510, 9987},
+    {2942308, 4355, 1674, 12196, 130, 3, 1007, 204, -26, -397, -23, 14, 520, 9986},
+    {2951923, 4422, 1819, 12273, 122, -6, 996, 202, -22, -399, -19, 16, 530, 9986},
+    {2961538, 4621, 1850, 12512, 126, -4, 997, 200, -21, -403, -16, 18, 540, 9985},
+    {2971154, 4802, 1938, 12394, 119, -4, 1007, 198, -18, -395, -13, 20, 550, 9985},
+    {2980769, 4793, 1904, 12600, 123, -5, 994, 202, -23, -397, -9, 22, 561, 9984},
+    {2990385, 4964, 1734, 12725, 131, -10, 1005, 206, -21, -409, -5, 24, 571, 9984},
+    {3000000, 4935, 1800, 12808, 126, 3, 996, 204, -21, -397, -1, 26, 581, 9983},
+    {3009615, 5173, 1820, 13000, 123, -5, 999, 203, -30, -398, 2, 28, 592, 9982},
+    {3019231, 5250, 1712, 13023, 125, -3, 998, 200, -29, -391, 6, 29, 603, 9982},
+    {3028846, 5184, 1703, 13037, 125, -4, 1001, 201, -24, -398, 10, 31, 613, 9981},
+    {3038462, 5200, 1743, 13125, 127, 3, 1002, 204, -36, -396, 14, 33, 624, 9980},
+    {3048077, 5153, 1535, 13218, 128, -4, 993, 199, -25, -397, 18, 35, 635, 9980},
+    {3057692, 5089, 1694, 13328, 120, 5, 1000, 202, -25, -399, 22, 37, 646, 9979},
+    {3067308, 5176, 1694, 13509, 126, 0, 1002, 196, -31, -400, 26, 39, 657, 9978},
+    {3076923, 5159, 1492, 13411, 130, 9, 997, 199, -28, -397, 30, 40, 668, 9978},
+    {3086538, 4987, 1419, 13662, 127, 0, 1000, 204, -35, -391, 34, 42, 679, 9977},
+    {3096154, 4926, 1355, 13741, 129, 13, 1006, 202, -23, -395, 37, 44, 690, 9976},
+    {3105769, 4793, 1401, 13908, 129, 1, 1006, 204, -38, -401, 41, 45, 701, 9975},
+    {3115385, 4562, 1335, 13919, 134, 6, 997, 198, -27, -404, 45, 47, 713, 9974},
+    {3125000, 4368, 1240, 14012, 136, 14, 1001, 201, -32, -395, 48, 48, 724, 9974},
+    {3134615, 4037, 1196, 14131, 132, 14, 1001, 199, -36, -403, 51, 50, 735, 9973},
+    {3144231, 3986, 942, 14203, 134, 11, 1004, 199, -31, -402, 54, 51, 747, 9972},
+    {3153846, 3658, 930, 14180, 131, 17, 1010, 199, -37, -400, 57, 52, 759, 9971},
+    {3163462, 3461, 877, 14338, 128, 14, 1005, 194, -34, -398, 60, 53, 770, 9970},
+    {3173077, 3189, 878, 14456, 131, 10, 994, 202, -35, -395, 63, 55, 782, 9969},
+    {3182692, 3094, 796, 14420, 139, 10, 1000, 199, -32, -394, 65, 56, 794, 9968},
+    {3192308, 2810, 460, 14595, 136, 16, 995, 202, -38, -397, 67, 56, 806, 9967},
+    {3201923, 2485, 374, 14815, 130, 15, 996, 206, -40, -398, 69, 57, 818, 9966},
+    {3211538, 2093, 291, 14821, 133, 15, 1001, 198, -41, -391, 71, 58, 830, 9965},
+    {3221154, 1981, 340, 15020, 135, 15, 1001, 202, -36, -398, 72, 58, 842, 9964},
+    {3230769, 1611, 253, 15008, 131, 16, 998, 200, -37, -392, 73, 59, 854, 9963},
+    {3240385, 1271, 147, 14956, 135, 17, 1003, 200, -37, -395, 74, 59, 867, 9962},
+    {3250000, 848, -45, 15118, 134, 23, 997, 204, -45, -393, 75, 59, 879, 9961},
+    {3259615, 445, -275, 15306, 133, 16, 995, 205, -34, -402, 75, 59, 891, 9960},
+    {3269231, 321, -214, 15321, 129, 9, 998, 200, -42, -401, 75, 59, 904, 9959},
+    {3278846, -264, -407, 15504, 135, 17, 1005, 191, -45, -397, 75, 59, 917, 9957},
+    {3288462, -590, -619, 15380, 142, 15, 996, 192, -46, -390, 74, 59, 929, 9956},
+    {3298077, -869, -716, 15602, 134, 17, 1002, 203, -49, -397, 73, 58, 942, 9955},
+    {3307692, -1205, -624, 15811, 139, 12, 1002, 202, -42, -397, 72, 58, 955, 9954},
+    {3317308, -1641, -834, 15770, 130, 16, 995, 201, -46, -398, 71, 57, 968, 9953},
+    {3326923, -2160, -977, 15712, 135, 19, 1000, 211, -47, -397, 69, 56, 981, 9951},
+    {3336538, -2401, -1100, 15980, 136, 19, 1001, 205, -47, -398, 67, 55, 994, 9950},
+    {3346154, -2694, -1245, 15923, 138, 16, 998, 202, -45, -399, 65, 54, 1007, 9949},
+    {3355769, -3011, -1341, 16141, 142, 14, 1004, 198, -48, -390, 62, 53, 1020, 9948},
+    {3365385, -3513, -1416, 16257, 144, 14, 1007, 197, -48, -396, 59, 51, 1033, 9946},
+    {3375000, -3622, -1645, 16232, 134, 11, 998, 201, -50, -395, 56, 50, 1046, 9945},
+    {3384615, -3998, -1788, 16239, 141, 17, 999, 202, -45, -406, 53, 48, 1059, 9943},
+    {3394231, -4268, -1962, 16349, 141, 7, 997, 193, -49, -399, 49, 46, 1073, 9942},
+    {3403846, -4657, -1993, 16512, 148, 12, 1002, 202, -43, -401, 45, 45, 1086, 9941},
+    {3413462, -4869, -2184, 16567, 136, 10, 1004, 191, -42, -397, 41, 42, 1100, 9939},
+    {3423077, -5181, -2240, 16582, 147, 9, 995, 198, -50, -404, 37, 40, 1113, 9938},
+    {3432692, -5276, -2599, 16691, 143, 8, 999, 194, -53, -402, 33, 38, 1127, 9936},
+    {3442308, -5531, -2369, 16725, 139, 11, 998, 199, -49, -400, 28, 36, 1141, 9935},
+    {3451923, -5718, -2683, 16905, 145, 7, 995, 196, -46, -395, 23, 33, 1154, 9933},
+    {3461538, -5883, -2623, 16946, 149, 9, 1008, 194, -54, -407, 18, 30, 1168, 9931},
+    {3471154, -5972, -2902, 16977, 142, 1, 998, 195, -48, -401, 13, 28, 1182, 9930},
+    {3480769, -6241, -2901, 17224, 144, -3, 1000, 200, -53, -401, 8, 25, 1196, 9928},
+    {3490385, -6335, -2840, 17198, 149, -4, 1001, 193, -46, -394, 3, 22, 1210, 9926},
+    {3500000, -6402, -3121, 17249, 151, -2, 998, 196, -48, -396, -2, 19, 1224, 9925},
+    {3509615, -6391, -3068, 17221, 147, 1, 997, 195, -53, -401, -8, 16, 1238, 9923},
+    {3519231, -6396, -3278, 17413, 149, -4, 999, 201, -47, -401, -13, 13, 1252, 9921},
+    {3528846, -6441, -3377, 17389, 145, -4, 1004, 189, -50, -399, -18, 9, 1267, 9919},
+    {3538462, -6282, -3488, 17468, 149, -4, 1001, 195, -45, -397, -24, 6, 1281, 9918},
+    {3548077, -6220, -3523, 17514, 150, 4, 1008, 200, -48, -406, -29, 3, 1295, 9916},
+    {3557692, -6142, -3605, 17509, 151, -3, 997, 197, -43, -404, -34, -1, 1309, 9914},
+    {3567308, -6089, -3474, 17762, 149, -5, 999, 188, -55, -394, -39, -4, 1324, 9912},
+    {3576923, -6001, -3563, 17750, 153, -6, 1006, 197, -46, -396, -44, -8, 1338, 9910},
+    {3586538, -5769, -3685, 17572, 153, -6, 1004, 190, -49, -397, -49, -11, 1353, 9908},
+    {3596154, -5615, -3808, 17929, 156, -4, 1009, 191, -51, -399, -54, -15, 1367, 9906},
+    {3605769, -5439, -3674, 17889, 145, -16, 997, 191, -49, -400, -58, -18, 1382, 9904},
+    {3615385, -5348, -3771, 17808, 152, -17, 1000, 192, -53, -404, -63, -22, 1397, 9902},
+    {3625000, -4832, -3896, 17949, 154, -15, 1002, 180, -43, -409, -67, -25, 1411, 9900},
+    {3634615, -4610, -3783, 18289, 141, -18, 997, 191, -57, -404, -71, -28, 1426, 9897},
+    {3644231, -4391, -3771, 18085, 154, -19, 995, 188, -53, -401, -74, -32, 1441, 9895},
+    {3653846, -4029, -3874, 18147, 154, -17, 1002, 191, -51, -399, -78, -35, 1456, 9893},
+    {3663462, -3532, -3733, 18264, 155, -20, 1000, 181, -44, -404, -81, -39, 1471, 9891},
+    {3673077, -3390, -3802, 18333, 154, -16, 997, 187, -52, -399, -84, -42, 1486, 9889},
+    {3682692, -2898, -3817, 18451, 153, -20, 998, 187, -49, -401, -86, -45, 1501, 9886},
+    {3692308, -2467, -3702, 18477, 152, -25, 999, 198, -47, -407, -89, -48, 1516, 9884},
+    {3701923, -2026, -3858, 18532, 150, -21, 1007, 178, -46, -405, -90, -51, 1531, 9882},
+    {3711538, -1628, -3609, 18581, 150, -18, 999, 190, -42, -405, -92, -54, 1546, 9879},
+    {3721154, -1267, -3625, 18667, 157, -24, 1000, 182, -53, -400, -93, -57, 1561, 9877},
+    {3730769, -771, -3475, 18796, 154, -16, 997, 184, -51, -405, -94, -60, 1576, 9874},
+    {3740385, -337, -3378, 18742, 156, -22, 1003, 185, -54, -402, -95, -63, 1592, 9872},
+    {3750000, 233, -3282, 18788, 156, -25, 998, 189, -58, -403, -95, -65, 1607, 9869},
+    {3759615, 561, -3192, 18923, 157, -14, 994, 184, -59, -409, -94, -67, 1622, 9867},
+    {3769231, 1065, -3016, 18925, 153, -19, 999, 189, -51, -412, -94, -70, 1638, 9864},
+    {3778846, 1533, -2977, 19069, 164, -20, 1005, 181, -59, -409, -93, -72, 1653, 9862},
+    {3788462, 2069, -2948, 19054, 157, -20, 999, 184, -58, -411, -91, -74, 1669, 9859},
+    {3798077, 2450, -2796, 19188, 154, -21, 995, 181, -52, -413, -90, -75, 1685, 9856},
+    {3807692, 2929, -2669, 19216, 157, -27, 999, 184, -56, -405, -87, -77, 1700, 9854},
+    {3817308, 3261, -2610, 19245, 150, -22, 1002, 184, -66, -401, -85, -78, 1716, 9851},
+    {3826923, 3829, -2355, 19434, 159, -16, 993, 184, -66, -401, -82, -80, 1732, 9848},
+    {3836538, 4343, -2310, 19408, 158, -23, 997, 183, -63, -408, -79, -81, 1747, 9846},
+    {3846154, 4780, -2113, 19414, 149, -21, 1003, 179, -58, -407, -75, -82, 1763, 9843},
+    {3855769, 5175, -1945, 19503, 155, -23, 994, 183, -56, -401, -72, -82, 1779, 9840},
+    {3865385, 5427, -1761, 19625, 159, -15, 996, 183, -64, -404, -67, -83, 1795, 9837},
+    {3875000, 5886, -1580, 19611, 156, -14, 1000, 176, -58, -405, -63, -83, 1811, 9834},
+    {3884615, 6235, -1574, 19744, 154, -12, 996, 185, -66, -402, -58, -83, 1827, 9831},
+    {3894231, 6689, -1380, 19658, 159, -8, 996, 187, -68, -405, -53, -83, 1843, 9828},
+    {3903846, 6909, -1084, 19704, 152, -14, 997, 182, -67, -405, -48, -83, 1859, 9825},
+    {3913462, 7372, -1039, 19791, 149, -9, 1000, 183, -68, -394, -42, -83, 1875, 9822},
+    {3923077, 7523, -873, 19915, 140, -12, 1001, 180, -69, -408, -37, -82, 1891, 9819},
+    {3932692, 7812, -672, 19874, 154, -12, 997, 180, -62, -407, -31, -81, 1908, 9816},
+    {3942308, 7918, -532, 19959, 147, -1, 993, 184, -66, -404, -24, -80, 1924, 9813},
+    {3951923, 8269, -173, 19994, 152, -2, 1000, 187, -72, -395, -18, -79, 1940, 9810},
+    {3961538, 8407, -102, 20046, 149, -7, 994, 178, -71, -404, -12, -78, 1956, 9806},
+    {3971154, 8467, 101, 20099, 148, -7, 997, 173, -78, -403, -5, -76, 1973, 9803},
+    {3980769, 8640, 368, 20254, 145, 2, 998, 173, -85, -400, 1, -74, 1989, 9800},
+    {3990385, 8657, 393, 20188, 143, -2, 997, 183, -81, -401, 8, -72, 2006, 9797},
+    {4000000, 8875, 668, 20397, 149, 0, 989, 176, -79, -403, 15, -70, 2022, 9793},
+    {4009615, 8811, 893, 20393, 145, 5, 995, 176, -77, -410, 21, -68, 2039, 9790},
+    {4019231, 8880, 972, 20239, 145, 2, 1002, 182, -75, -396, 28, -66, 2055, 9786},
+    {4028846, 8807, 1298, 20509, 146, 13, 996, 182, -87, -404, 34, -63, 2072, 9783},
+    {4038462, 8868, 1413, 20486, 146, 4, 1004, 178, -79, -405, 41, -60, 2088, 9779},
+    {4048077, 8732, 1776, 20629, 141, 4, 997, 176, -76, -410, 47, -58, 2105, 9776},
+    {4057692, 8447, 1857, 20485, 137, 9, 1003, 181, -88, -403, 54, -55, 2122, 9772},
+    {4067308, 8438, 1994, 20671, 139, 7, 992, 179, -84, -395, 60, -52, 2138, 9768},
+    {4076923, 8306, 1981, 20676, 140, 14, 995, 171, -97, -409, 66, -48, 2155, 9765},
+    {4086538, 7996, 2408, 20659, 139, 9, 1001, 179, -92, -401, 72, -45, 2172, 9761},
+    {4096154, 7792, 2469, 20709, 133, 9, 998, 180, -91, -406, 77, -42, 2188, 9757},
+    {4105769, 7524, 2580, 20682, 130, 13, 996, 169, -94, -396, 82, -38, 2205, 9753},
+    {4115385, 7146, 2679, 20781, 132, 17, 999, 176, -90, -400, 88, -35, 2222, 9750},
+    {4125000, 6836, 2979, 20725, 133, 17, 997, 183, -91, -401, 92, -31, 2239, 9746},
+    {4134615, 6471, 3078, 20916, 132, 15, 999, 175, -93, -405, 97, -27, 2256, 9742},
+    {4144231, 6232, 3205, 20844, 126, 14, 995, 171, -88, -393, 101, -24, 2273, 9738},
+    {4153846, 5674, 3415, 20980, 131, 13, 993, 183, -102, -405, 105, -20, 2289, 9734},
+    {4163462, 5339, 3427, 21002, 124, 23, 1005, 179, -94, -407, 108, -16, 2306, 9730},
+    {4173077, 4854, 3498, 20928, 115, 22, 993, 170, -105, -405, 111, -12, 2323, 9726},
+    {4182692, 4385, 3679, 20887, 113, 25, 998, 175, -106, -405, 114, -8, 2340, 9722},
+    {4192308, 3820, 3764, 21057, 122, 15, 998, 175, -96, -400, 116, -5, 2357, 9718},
+    {4201923, 3370, 4003, 21303, 118, 19, 993, 168, -96, -403, 118, -1, 2374, 9713},
+    {4211538, 2899, 3940, 21206, 112, 25, 998, 177, -100, -397, 119, 3, 2391, 9709},
+    {4221154, 2483, 3985, 21115, 120, 26, 994, 175, -97, -406, 120, 7, 2408, 9705},
+    {4230769, 1811, 4091, 21288, 114, 24, 1004, 183, -107, -397, 121, 10, 2425, 9701},
+    {4240385, 1358, 4265, 21292, 109, 30, 1005, 176, -108, -397, 121, 14, 2442, 9696},
+    {4250000, 814, 4181, 21309, 108, 29, 995, 175, -100, -392, 120, 18, 2460, 9692},
+    {4259615, 241, 4244, 21389, 106, 21, 995, 172, -110, -399, 119, 21, 2477, 9688},
+    {4269231, -285, 4283, 21343, 98, 31, 1003, 179, -110, -394, 118, 24, 2494, 9683},
+    {4278846, -854, 4429, 21471, 99, 28, 990, 173, -111, -403, 116, 28, 2511, 9679},
+    {4288462, -1510, 4338, 21595, 103, 15, 1007, 172, -109, -402, 114, 31, 2528, 9674},
+    {4298077, -1958, 4326, 21461, 96, 23, 1001, 178, -109, -392, 112, 34, 2545, 9670},
+    {4307692, -2349, 4313, 21516, 101, 33, 1003, 174, -118, -401, 109, 37, 2563, 9665},
+    {4317308, -3035, 4339, 21484, 99, 21, 993, 173, -105, -397, 105, 40, 2580, 9661},
+    {4326923, -3563, 4363, 21659, 93, 25, 998, 173, -103, -399, 101, 43, 2597, 9656},
+    {4336538, -4056, 4249, 21673, 83, 22, 1002, 168, -108, -400, 97, 45, 2614, 9652},
+    {4346154, -4471, 4162, 21670, 92, 16, 992, 178, -118, -404, 92, 48, 2632, 9647},
+    {4355769, -4968, 4273, 21661, 96, 17, 1002, 171, -109, -399, 87, 50, 2649, 9642},
+    {4365385, -5382, 4137, 21683, 89, 24, 1003, 176, -119, -396, 82, 52, 2666, 9637},
+    {4375000, -5908, 4121, 21849, 84, 17, 999, 172, -111, -395, 76, 54, 2684, 9633},
+    {4384615, -6305, 3841, 21777, 78, 13, 1006, 174, -115, -398, 70, 56, 2701, 9628},
+    {4394231, -6601, 3825, 21737, 81, 9, 1003, 171, -119, -397, 63, 58, 2719, 9623},
+    {4403846, -7063, 3704, 21876, 77, 9, 995, 171, -114, -396, 57, 59, 2736, 9618},
+    {4413462, -7302, 3581, 21889, 86, 13, 999, 177, -109, -392, 50, 60, 2754, 9613},
+    {4423077, -7710, 3554, 22005, 80, 10, 1003, 176, -113, -397, 43, 62, 2771, 9608},
+    {4432692, -7934, 3338, 22025, 75, 9, 1002, 177, -106, -399, 35, 63, 2789, 9603},
+    {4442308, -8243, 3267, 22024, 72, 12, 1008, 172, -109, -399, 28, 63, 2806, 9598},
+    {4451923, -8558, 3178, 21982, 68, 6, 1009, 170, -116, -395, 20, 64, 2824, 9593},
+    {4461538, -8621, 3064, 22102, 77, 3, 1001, 169, -113, -392, 12, 65, 2841, 9588},
+    {4471154, -8644, 2825, 22151, 63, 2, 1005, 168, -114, -401, 4, 65, 2859, 9582},
+    {4480769, -8888, 2779, 22223, 67, 4, 1008, 173, -109, -395, -4, 65, 2876, 9577},
+    {4490385, -8988, 2397, 22145, 67, 5, 1005, 176, -111, -395, -12, 65, 2894, 9572},
+    {4500000, -9030, 2390, 22180, 57, -3, 996, 180, -114, -399, -20, 65, 2911, 9567},
+    {4509615, -9112, 2194, 22177, 58, -4, 1000, 168, -116, -402, -28, 65, 2929, 9561},
+    {4519231, -8946, 2023, 22271, 56, -5, 998, 170, -107, -396, -36, 65, 2947, 9556},
+    {4528846, -9105, 1805, 22378, 63, 0, 1002, 173, -113, -389, -44, 64, 2964, 9550},
+    {4538462, -8831, 1626, 22196, 47, -7, 997, 165, -109, -395, -52, 63, 2982, 9545},
+    {4548077, -8720, 1441, 22313, 50, -9, 1002, 166, -112, -401, -59, 63, 3000, 9539},
+    {4557692, -8721, 1185, 22358, 46, -9, 1000, 166, -112, -390, -67, 62, 3017, 9534},
+    {4567308, -8277, 937, 22212, 49, -14, 997, 167, -111, -397, -74, 61, 3035, 9528},
+    {4576923, -8226, 823, 22410, 49, -7, 1000, 166, -116, -401, -81, 60, 3053, 9522},
+    {4586538, -7929, 578, 22445, 43, -15, 997, 170, -113, -394, -88, 58, 3070, 9516},
+    {4596154, -7595, 336, 22355, 54, -12, 1004, 173, -118, -393, -95, 57, 3088, 9511},
+    {4605769, -7340, 155, 22312, 43, -10, 1002, 176, -112, -402, -101, 56, 3106, 9505},
+    {4615385, -6904, -46, 22341, 42, -20, 1008, 175, -107, -408, -107, 54, 3123, 9499},
+    {4625000, -6659, -195, 22349, 37, -20, 1002, 170, -121, -396, -113, 52, 3141, 9493},
+    {4634615, -6282, -606, 22561, 40, -24, 1000, 166, -110, -405, -118, 51, 3159, 9487},
+    {4644231, -5871, -694, 22569, 38, -16, 998, 168, -114, -393, -123, 49, 3176, 9481},
+    {4653846, -5330, -791, 22481, 36, -12, 998, 168, -116, -404, -128, 47, 3194, 9475},
+    {4663462, -4933, -985, 22556, 33, -21, 1001, 172, -111, -404, -132, 46, 3212, 9469},
+    {4673077, -4502, -1291, 22451, 35, -21, 997, 165, -120, -398, -136, 44, 3229, 9463},
+    {4682692, -3816, -1486, 22488, 26, -26, 1004, 171, -113, -393, -139, 42, 3247, 9457},
+    {4692308, -3405, -1668, 22579, 29, -19, 996, 159, -111, -408, -142, 40, 3265, 9451},
+    {4701923, -2865, -1900, 22611, 28, -27, 1004, 160, -115, -409, -144, 38, 3282, 9445},
+    {4711538, -2270, -2053, 22523, 23, -30, 1004, 161, -112, -401, -146, 36, 3300, 9439},
+    {4721154, -1757, -2242, 22565, 28, -25, 1000, 163, -112, -395, -147, 34, 3318, 9432},
+    {4730769, -1155, -2469, 22595, 27, -28, 998, 160, -121, -401, -148, 33, 3335, 9426},
+    {4740385, -631, -2564, 22374, 29, -30, 1001, 165, -113, -398, -148, 31, 3353, 9420},
+    {4750000, -150, -2787, 22585, 22, -25, 1003, 163, -117, -403, -148, 29, 3371, 9414},
+    {4759615, 593, -2870, 22679, 19, -34, 1005, 163, -120, -398, -147, 27, 3388, 9407},
+    {4769231, 1046, -3056, 22498, 17, -29, 1005, 160, -119, -402, -146, 25, 3406, 9401},
+    {4778846, 1624, -3271, 22628, 20, -29, 997, 156, -115, -395, -145, 24, 3423, 9395},
+    {4788462, 2236, -3427, 22495, 15, -22, 997, 161, -112, -403, -143, 22, 3441, 9388},
+    {4798077, 2810, -3541, 22593, 18, -29, 994, 153, -110, -396, -140, 20, 3459, 9382},
+    {4807692, 3292, -3667, 22679, 17, -29, 1000, 157, -115, -399, -137, 19, 3476, 9375},
+    {4817308, 3858, -3746, 22784, 18, -29, 1002, 150, -121, -404, -133, 17, 3494, 9369},
+    {4826923, 4442, -3874, 22769, 12, -29, 1003, 156, -123, -404, -129, 16, 3511, 9362},
+    {4836538, 5041, -4026, 22501, 18, -28, 1003, 154, -124, -399, -125, 14, 3529, 9356},
+    {4846154, 5341, -4016, 22522, 14, -27, 994, 151, -125, -405, -120, 13, 3547, 9349},
+    {4855769, 5928, -4088, 22780, 14, -14, 995, 152, -129, -406, -114, 12, 3564, 9343},
+    {4865385, 6377, -4247, 22616, 13, -20, 993, 154, -123, -404, -109, 10, 3582, 9336},
+    {4875000, 6824, -4356, 22716, 3, -18, 998, 148, -128, -402, -103, 9, 3599, 9329},
+    {4884615, 7259, -4439, 22743, 12, -6, 996, 152, -136, -397, -96, 8, 3617, 9323},
+    {4894231, 7620, -4436, 22782, 9, -18, 994, 147, -132, -406, -89, 7, 3634, 9316},
+    {4903846, 7949, -4602, 22697, 8, -13, 996, 146, -130, -398, -82, 6, 3652, 9309},
+    {4913462, 8291, -4675, 22677, 7, -12, 994, 149, -133, -401, -75, 5, 3669, 9302},
+    {4923077, 8560, -4732, 22750, 12, -5, 999, 147, -131, -401, -67, 4, 3687, 9295},
+    {4932692, 8707, -4745, 22772, 5, -9, 1008, 141, -132, -401, -59, 4, 3704, 9288},
+    {4942308, 9163, -4760, 22739, 4, -5, 1000, 145, -130, -402, -51, 3, 3722, 9281},
+    {4951923, 9300, -4778, 22807, 4, -6, 992, 148, -129, -399, -43, 2, 3739, 9274},
+    {4961538, 9579, -4578, 22705, 6, -3, 1003, 147, -135, -400, -35, 2, 3757, 9267},
+    {4971154, 9472, -4615, 22741, 6, -4, 994, 141, -137, -400, -26, 1, 3774, 9260},
+    {4980769, 9693, -4811, 22833, -1, -7, 1000, 144, -140, -392, -17, 1, 3792, 9253},
+    {4990385, 9835, -4683, 22752, 0, 6, 1001, 144, -144, -398, -9, 0, 3809, 9246},
+    {5000000, 9910, -4619, 22814, -3, 1, 995, 141, -130, -402, 0, 0, 3827, 9239},
+    {5009615, 9746, -4506, 22818, 4, 9, 1006, 141, -140, -400, 9, 0, 3844, 9232},
+    {5019231, 9749, -4602, 22846, -5, 2, 997, 139, -148, -401, 17, -1, 3862, 9224},
+    {5028846, 9795, -4557, 22805, 0, 3, 1002, 142, -143, -400, 26, -1, 3879, 9217},
+    {5038462, 9530, -4505, 22788, -10, 5, 1008, 141, -143, -393, 35, -1, 3897, 9210},
+    {5048077, 9493, -4472, 22773, 0, 3, 1002, 133, -142, -393, 43, -2, 3914, 9202},
+    {5057692, 9360, -4193, 22933, -9, 10, 996, 143, -148, -393, 51, -2, 3931, 9195},
+    {5067308, 9041, -4311, 22908, 2, 9, 1004, 140, -143, -404, 59, -2, 3949, 9187},
+    {5076923, 8871, -4093, 22897, -5, 20, 1004, 137, -153, -399, 67, -2, 3966, 9180},
+    {5086538, 8684, -3986, 22813, -7, 17, 1001, 128, -153, -405, 75, -3, 3983, 9172},
+    {5096154, 8385, -3972, 22882, -5, 17, 1004, 134, -151, -398, 82, -3, 4001, 9165},
+    {5105769, 7929, -3761, 22868, -5, 15, 1000, 144, -151, -412, 90, -3, 4018, 9157},
+    {5115385, 7536, -3634, 22885, -10, 11, 1001, 134, -158, -401, 96, -4, 4035, 9149},
+    {5125000, 7237, -3531, 22822, -14, 24, 998, 131, -153, -398, 103, -4, 4052, 9142},
+    {5134615, 6937, -3484, 22813, -12, 15, 998, 132, -158, -396, 109, -5, 4070, 9134},
+    {5144231, 6395, -3383, 22807, -13, 22, 995, 126, -162, -402, 115, -5, 4087, 9126},
+    {5153846, 6073, -3114, 22884, -14, 29, 1003, 130, -167, -399, 120, -6, 4104, 9118},
+    {5163462, 5414, -2959, 22804, -8, 30, 996, 133, -154, -403, 125, -6, 4121, 9110},
+    {5173077, 5022, -2853, 22822, -16, 23, 1001, 129, -157, -401, 130, -7, 4138, 9103},
+    {5182692, 4371, -2656, 22774, -14, 24, 1001, 127, -164, -396, 134, -7, 4156, 9095},
+    {5192308, 3983, -2533, 22827, -16, 23, 1007, 123, -163, -404, 138, -8, 4173, 9087},
+    {5201923, 3365, -2416, 22714, -8, 29, 1000, 126, -164, -400, 141, -9, 4190, 9079},
+    {5211538, 2875, -2238, 22744, -23, 21, 989, 123, -155, -394, 144, -10, 4207, 9071},
+    {5221154, 2311, -2202, 22793, -13, 32, 996, 126, -173, -392, 146, -11, 4224, 9063},
+    {5230769, 1831, -1963, 22867, -14, 29, 1006, 121, -163, -401, 148, -12, 4241, 9055},
+    {5240385, 1227, -1614, 22803, -21, 21, 999, 124, -169, -398, 149, -13, 4258, 9047},
+    {5250000, 715, -1801, 22695, -14, 35, 993, 126, -163, -393, 150, -14, 4275, 9039},
+    {5259615, 89, -1466, 22632, -24, 28, 996, 120, -161, -406, 151, -15, 4292, 9031},
+    {5269231, -353, -1209, 22613, -31, 22, 997, 117, -168, -399, 151, -17, 4309, 9023},
+    {5278846, -909, -1069, 22585, -25, 31, 994, 115, -169, -404, 150, -18, 4326, 9015},
+    {5288462, -1526, -839, 22561, -24, 28, 993, 113, -169, -397, 149, -20, 4343, 9007},
+    {5298077, -2112, -765, 22642, -27, 19, 1010, 115, -162, -397, 147, -21, 4359, 8999},
+    {5307692, -2756, -573, 22597, -23, 30, 1007, 123, -170, -391, 145, -23, 4376, 8990},
+    {5317308, -3097, -471, 22586, -31, 24, 1003, 121, -164, -395, 143, -24, 4393, 8982},
+    {5326923, -3658, -345, 22500, -29, 19, 1007, 113, -164, -399, 140, -26, 4410, 8974},
+    {5336538, -4231, -58, 22625, -38, 21, 993, 110, -169, -401, 137, -28, 4426, 8966},
+    {5346154, -4582, 156, 22408, -33, 26, 999, 119, -167, -402, 133, -30, 4443, 8958},
+    {5355769, -5130, 245, 22555, -37, 20, 990, 110, -169, -405, 129, -32, 4460, 8949},
+    {5365385, -5510, 388, 22474, -37, 16, 1004, 119, -174, -403, 124, -34, 4476, 8941},
+    {5375000, -6075, 667, 22449, -52, 16, 996, 108, -168, -395, 119, -35, 4493, 8933},
+    {5384615, -6268, 742, 22351, -39, 16, 999, 114, -169, -393, 114, -37, 4510, 8925},
+    {5394231, -6498, 946, 22267, -40, 19, 1003, 112, -173, -400, 109, -39, 4526, 8916},
+    {5403846, -6880, 962, 22293, -35, 12, 998, 105, -168, -397, 103, -41, 4543, 8908},
+    {5413462, -7049, 1203, 22357, -49, 12, 994, 109, -169, -397, 97, -43, 4559, 8900},
+    {5423077, -7489, 1394, 22324, -49, 17, 1008, 111, -166, -402, 90, -45, 4576, 8891},
+    {5432692, -7742, 1506, 22327, -52, 9, 998, 116, -164, -399, 83, -47, 4592, 8883},
+    {5442308, -7913, 1597, 22226, -49, 1, 1001, 105, -167, -407, 77, -49, 4608, 8874},
+    {5451923, -8157, 1727, 22265, -48, 5, 1005, 104, -162, -404, 69, -51, 4625, 8866},
+    {5461538, -8322, 1843, 22287, -56, 1, 1000, 107, -170, -403, 62, -53, 4641, 8857},
+    {5471154, -8308, 1968, 22206, -52, 6, 1002, 98, -162, -395, 55, -55, 4657, 8849},
+    {5480769, -8410, 2182, 22291, -64, -2, 995, 109, -173, -399, 47, -57, 4673, 8840},
+    {5490385, -8371, 2175, 22204, -58, 5, 1010, 110, -156, -407, 40, -59, 4690, 8832},
+    {5500000, -8353, 2273, 22203, -63, 1, 1001, 102, -167, -403, 32, -60, 4706, 8823},
+    {5509615, -8380, 2538, 22117, -62, -8, 1008, 101, -163, -404, 24, -62, 4722, 8815},
+    {5519231, -8237, 2612, 22159, -66, -3, 1005, 109, -164, -399, 17, -63, 4738, 8806},
+    {5528846, -8213, 2539, 21998, -67, -4, 1004, 100, -168, -403, 9, -65, 4754, 8797},
+    {5538462, -8218, 2671, 22189, -67, -7, 1001, 102, -161, -398, 1, -66, 4770, 8789},
+    {5548077, -8027, 2834, 22045, -69, -1, 1008, 101, -161, -398, -6, -67, 4786, 8780},
+    {5557692, -7667, 2923, 22010, -75, -2, 993, 101, -170, -413, -13, -68, 4802, 8771},
+    {5567308, -7583, 2967, 22139, -78, -10, 1004, 102, -159, -404, -21, -69, 4818, 8762},
+    {5576923, -7306, 3092, 22158, -75, -19, 994, 106, -169, -405, -28, -70, 4834, 8754},
+    {5586538, -6924, 3122, 21986, -77, -15, 1007, 96, -165, -404, -35, -70, 4850, 8745},
+    {5596154, -6616, 3038, 21988, -82, -21, 996, 107, -168, -403, -42, -70, 4866, 8736},
+    {5605769, -6365, 3233, 21879, -82, -13, 1005, 103, -158, -405, -48, -71, 4882, 8727},
+    {5615385, -5926, 3271, 22071, -88, -11, 1002, 104, -164, -407, -55, -71, 4897, 8718},
+    {5625000, -5662, 3197, 21802, -82, -17, 1001, 100, -159, -403, -61, -71, 4913, 8709},
+    {5634615, -5233, 3294, 21822, -81, -19, 1006, 109, -165, -402, -67, -70, 4929, 8700},
+    {5644231, -4730, 3301, 21812, -83, -21, 1005, 101, -165, -402, -72, -70, 4944, 8692},
+    {5653846, -4261, 3374, 21850, -89, -13, 1008, 95, -160, -407, -77, -69, 4960, 8683},
+    {5663462, -3960, 3397, 21677, -92, -15, 998, 100, -164, -401, -82, -68, 4976, 8674},
+    {5673077, -3324, 3415, 21811, -95, -12, 1001, 100, -168, -403, -87, -67, 4991, 8665},
+    {5682692, -2859, 3350, 21702, -88, -17, 997, 100, -157, -401, -91, -66, 5007, 8656},
+    {5692308, -2494, 3425, 21780, -98, -32, 997, 101, -168, -412, -95, -64, 5022, 8647},
+    {5701923, -2040, 3363, 21683, -99, -27, 997, 89, -168, -399, -99, -63, 5038, 8638},
+    {5711538, -1463, 3325, 21750, -101, -31, 1002, 103, -174, -404, -102, -61, 5053, 8629},
+    {5721154, -921, 3434, 21580, -110, -17, 1004, 95, -164, -407, -104, -59, 5069, 8619},
+    {5730769, -421, 3279, 21508, -107, -30, 1002, 98, -165, -404, -107, -56, 5084, 8610},
+    {5740385, 23, 3189, 21498, -99, -23, 997, 99, -163, -401, -109, -54, 5099, 8601},
+    {5750000, 633, 3128, 21343, -112, -22, 992, 95, -166, -401, -110, -51, 5114, 8592},
+    {5759615, 1271, 3015, 21523, -113, -28, 1004, 90, -164, -400, -112, -48, 5130, 8583},
+    {5769231, 1713, 3071, 21393, -112, -24, 1004, 97, -168, -405, -112, -45, 5145, 8574},
+    {5778846, 2254, 2981, 21375, -115, -19, 1002, 90, -172, -396, -113, -42, 5160, 8565},
+    {5788462, 2695, 3082, 21324, -110, -25, 997, 95, -167, -401, -113, -38, 5175, 8556},
+    {5798077, 3099, 2897, 21323, -105, -30, 1003, 99, -170, -404, -113, -35, 5190, 8547},
+    {5807692, 3547, 2866, 21275, -116, -18, 993, 87, -168, -404, -112, -31, 5205, 8538},
+    {5817308, 3938, 2769, 21178, -116, -22, 999, 95, -172, -402, -111, -27, 5220, 8529},
+    {5826923, 4534, 2767, 21158, -123, -21, 1001, 93, -176, -405, -109, -23, 5235, 8520},
+    {5836538, 5010, 2487, 21071, -120, -25, 996, 97, -170, -400, -108, -19, 5250, 8510},
+    {5846154, 5328, 2578, 21046, -124, -13, 997, 101, -171, -405, -105, -15, 5265, 8501},
+    {5855769, 5739, 2422, 20986, -129, -13, 994, 92, -170, -406, -103, -10, 5279, 8492},
+    {5865385, 5998, 2272, 21140, -121, -20, 1000, 99, -176, -396, -100, -6, 5294, 8483},
+    {5875000, 6465, 2268, 20948, -129, -19, 1004, 88, -171, -406, -97, -1, 5309, 8474},
+    {5884615, 6647, 2269, 20880, -132, -15, 1004, 95, -178, -405, -94, 4, 5323, 8465},
+    {5894231, 7031, 2150, 20711, -137, -9, 999, 96, -171, -404, -90, 8, 5338, 8456},
+    {5903846, 7341, 1877, 20799, -131, -13, 1001, 96, -172, -399, -87, 13, 5353, 8446},
+    {5913462, 7547, 1815, 20727, -137, -12, 1003, 85, -177, -404, -83, 18, 5367, 8437},
+    {5923077, 7677, 1620, 20690, -134, -10, 1004, 93, -178, -402, -78, 23, 5381, 8428},
+    {5932692, 7881, 1499, 20701, -136, -7, 998, 91, -179, -398, -74, 28, 5396, 8419},
+    {5942308, 8008, 1279, 20582, -135, -10, 1001, 89, -179, -402, -69, 32, 5410, 8410},
+    {5951923, 8094, 1295, 20596, -137, -5, 1001, 85, -189, -392, -65, 37, 5424, 8401},
+    {5961538, 8199, 1233, 20525, -145, -8, 999, 84, -176, -399, -60, 42, 5439, 8391},
+    {5971154, 8242, 1041, 20519, -144, -6, 1001, 82, -178, -396, -55, 47, 5453, 8382},
+    {5980769, 8427, 961, 20432, -142, -10, 998, 85, -178, -401, -50, 51, 5467, 8373},
+    {5990385, 8394, 752, 20345, -147, 4, 1000, 81, -185, -405, -45, 56, 5481, 8364},
+    {6000000, 8158, 706, 20222, -144, 1, 1001, 83, -179, -396, -39, 60, 5495, 8355},
+    {6009615, 8257, 532, 20415, -137, -4, 1000, 88, -182, -400, -34, 64, 5509, 8345},
+    {6019231, 8091, 352, 20168, -150, -3, 1001, 79, -188, -398, -29, 68, 5523, 8336},
+    {6028846, 8125, 293, 20104, -145, 11, 997, 83, -189, -399, -24, 72, 5537, 8327},
+    {6038462, 7755, 95, 20086, -154, 5, 996, 79, -181, -409, -19, 76, 5550, 8318},
+    {6048077, 7705, -71, 20086, -149, 3, 995, 77, -192, -402, -14, 80, 5564, 8309},
+    {6057692, 7535, -25, 20041, -153, 13, 999, 85, -189, -406, -9, 84, 5578, 8299},
+    {6067308, 7233, -398, 19924, -147, 9, 1000, 77, -185, -394, -4, 87, 5592, 8290},
+    {6076923, 6987, -385, 19882, -147, 12, 1004, 78, -189, -396, 1, 90, 5605, 8281},
+    {6086538, 6818, -595, 19687, -152, 17, 995, 80, -194, -403, 6, 93, 5619, 8272},
+    {6096154, 6279, -588, 19692, -149, 11, 998, 80, -194, -394, 11, 95, 5632, 8263},
+    {6105769, 6029, -937, 19714, -161, 16, 1002, 76, -187, -405, 15, 98, 5646, 8253},
+    {6115385, 5766, -995, 19609, -151, 15, 995, 77, -190, -393, 19, 100, 5659, 8244},
+    {6125000, 5324, -1111, 19626, -146, 13, 1003, 77, -198, -399, 23, 102, 5672, 8235},
+    {6134615, 4974, -1225, 19527, -152, 20, 998, 79, -194, -391, 27, 103, 5686, 8226},
+    {6144231, 4617, -1397, 19576, -157, 17, 998, 78, -202, -398, 31, 105, 5699, 8216},
+    {6153846, 4230, -1461, 19367, -150, 17, 1005, 72, -205, -393, 34, 106, 5712, 8207},
+    {6163462, 3699, -1640, 19401, -149, 19, 1005, 73, -197, -391, 38, 107, 5725, 8198},
+    {6173077, 3323, -1737, 19483, -153, 21, 1004, 71, -195, -393, 41, 107, 5738, 8189},
+    {6182692, 2962, -1784, 19265, -152, 12, 995, 76, -191, -403, 43, 107, 5751, 8180},
+    {6192308, 2523, -1867, 19391, -158, 16, 1003, 73, -192, -396, 46, 107, 5764, 8171},
+    {6201923, 2114, -2095, 19194, -155, 24, 994, 74, -201, -399, 48, 107, 5777, 8161},
+    {6211538, 1505, -2154, 19232, -154, 20, 997, 65, -188, -394, 50, 106, 5790, 8152},
+    {6221154, 1044, -2345, 19063, -152, 19, 994, 64, -200, -393, 52, 105, 5803, 8143},
+    {6230769, 695, -2379, 19143, -151, 20, 997, 63, -203, -394, 53, 104, 5816, 8134},
+    {6240385, 329, -2526, 19103, -149, 20, 1003, 70, -202, -395, 55, 102, 5829, 8125},
+    {6250000, -250, -2628, 19067, -148, 19, 996, 66, -197, -396, 56, 100, 5842, 8116},
+    {6259615, -823, -2733, 18782, -157, 18, 998, 70, -192, -392, 56, 98, 5854, 8107},
+    {6269231, -1172, -2749, 18753, -156, 17, 999, 66, -199, -390, 57, 96, 5867, 8097},
+    {6278846, -1599, -2812, 18766, -156, 20, 1002, 58, -195, -396, 57, 93, 5879, 8088},
+    {6288462, -1860, -2914, 18585, -158, 26, 1000, 71, -203, -395, 57, 90, 5892, 8079},
+    {6298077, -2345, -2923, 18785, -149, 14, 1002, 63, -195, -391, 57, 87, 5904, 8070},
+    {6307692, -2910, -3049, 18633, -156, 23, 1005, 61, -198, -391, 56, 84, 5917, 8061},
+    {6317308, -3171, -3099, 18578, -155, 19, 999, 66, -202, -399, 55, 80, 5929, 8052},
+    {6326923, -3651, -3062, 18515, -154, 9, 991, 62, -192, -400, 54, 76, 5941, 8043},
+    {6336538, -3819, -3189, 18364, -155, 15, 1002, 64, -196, -390, 53, 72, 5954, 8034},
+    {6346154, -4063, -3258, 18325, -156, 8, 998, 56, -198, -389, 52, 68, 5966, 8025},
+    {6355769, -4428, -3222, 18273, -157, 17, 1003, 53, -198, -397, 50, 63, 5978, 8016},
+    {6365385, -4804, -3345, 18300, -153, 16, 1001, 57, -193, -399, 48, 59, 5990, 8007},
+    {6375000, -4951, -3283, 18176, -151, 12, 998, 57, -199, -398, 46, 54, 6002, 7998},
+    {6384615, -5232, -3250, 18032, -143, 11, 1002, 52, -198, -393, 44, 49, 6014, 7989},
+    {6394231, -5506, -3371, 17962, -155, 13, 1005, 57, -194, -402, 42, 44, 6026, 7980},
+    {6403846, -5601, -3158, 17977, -147, 8, 999, 51, -192, -402, 40, 39, 6038, 7971},
+    {6413462, -5787, -3423, 17917, -150, 13, 994, 49, -199, -400, 37, 34, 6049, 7963},
+    {6423077, -6063, -3443, 17784, -142, 12, 997, 49, -199, -400, 35, 28, 6061, 7954},
+    {6432692, -6151, -3317, 17688, -157, 10, 1005, 51, -193, -398, 32, 23, 6073, 7945},
+    {6442308, -6135, -3415, 17716, -138, 10, 997, 57, -192, -397, 29, 18, 6084, 7936},
+    {6451923, -6227, -3426, 17477, -147, 9, 997, 52, -193, -400, 26, 12, 6096, 7927},
+    {6461538, -6375, -3237, 17442, -153, 6, 995, 48, -190, -402, 23, 7, 6107, 7918},
+    {6471154, -6425, -3284, 17495, -157, 5, 998, 49, -196, -401, 21, 1, 6119, 7910},
+    {6480769, -6475, -3179, 17310, -142, 4, 1004, 52, -192, -398, 18, -4, 6130, 7901},
+    {6490385, -6163, -3101, 17140, -144, 5, 997, 52, -192, -395, 15, -10, 6141, 7892},
+    {6500000, -6134, -3098, 17136, -145, -4, 1003, 43, -192, -395, 12, -15, 6152, 7883},
+    {6509615, -6147, -3101, 17073, -147, -5, 999, 51, -191, -398, 9, -20, 6163, 7875},
+    {6519231, -6019, -3040, 17040, -147, -7, 993, 38, -200, -396, 6, -25, 6174, 7866},
+    {6528846, -5913, -2942, 17026, -144, 3, 1001, 41, -188, -405, 3, -31, 6185, 7857},
+    {6538462, -5870, -2819, 16902, -145, -3, 997, 50, -196, -401, 0, -35, 6196, 7849},
+    {6548077, -5555, -2798, 16838, -141, -4, 997, 44, -203, -401, -2, -40, 6207, 7840},
+    {6557692, -5410, -2522, 16761, -142, -4, 995, 41, -192, -405, -5, -45, 6218, 7832},
+    {6567308, -5043, -2578, 16686, -146, -2, 996, 44, -194, -399, -7, -49, 6229, 7823},
+    {6576923, -4787, -2615, 16494, -145, -8, 995, 40, -192, -397, -10, -54, 6239, 7814},
+    {6586538, -4619, -2469, 16470, -145, -10, 999, 33, -194, -405, -12, -58, 6250, 7806},
+    {6596154, -4204, -2435, 16497, -141, -8, 997, 36, -190, -407, -14, -62, 6261, 7797},
+    {6605769, -4197, -2255, 16211, -134, -2, 991, 44, -194, -400, -16, -66, 6271, 7789},
+    {6615385, -3806, -2084, 16294, -142, -15, 995, 39, -195, -402, -18, -69, 6282, 7781},
+    {6625000, -3474, -2035, 16157, -141, -9, 997, 34, -189, -408, -20, -72, 6292, 7772},
+    {6634615, -3165, -2103, 16026, -147, -13, 999, 39, -191, -405, -21, -75, 6302, 7764},
+    {6644231, -2737, -1788, 16063, -137, -11, 1007, 44, -196, -401, -23, -78, 6312, 7755},
+    {6653846, -2504, -1680, 15978, -140, -14, 997, 32, -200, -399, -24, -81, 6323, 7747},
+    {6663462, -2045, -1601, 15812, -139, -19, 1006, 36, -183, -409, -25, -83, 6333, 7739},
+    {6673077, -1759, -1484, 15796, -141, -16, 1001, 35, -191, -409, -26, -85, 6343, 7730},
+    {6682692, -1280, -1432, 15691, -129, -7, 997, 29, -189, -397, -27, -87, 6353, 7722},
+    {6692308, -980, -1254, 15661, -135, -13, 1000, 36, -188, -402, -28, -88, 6363, 7714},
+    {6701923, -686, -1202, 15555, -138, -18, 1002, 29, -187, -401, -28, -89, 6373, 7706},
+    {6711538, -265, -1011, 15471, -136, -15, 993, 31, -196, -408, -28, -90, 6382, 7698},
+    {6721154, 72, -999, 15373, -126, -15, 999, 34, -187, -407, -28, -91, 6392, 7690},
+    {6730769, 379, -793, 15331, -135, -20, 1005, 30, -197, -409, -28, -91, 6402, 7682},
+    {6740385, 858, -561, 15168, -135, -17, 1005, 29, -196, -402, -28, -92, 6412, 7673},
+    {6750000, 1124, -598, 15135, -135, -20, 1004, 34, -190, -405, -27, -91, 6421, 7665},
+    {6759615, 1582, -316, 14915, -133, -19, 996, 31, -185, -404, -27, -91, 6431, 7657},
+    {6769231, 1904, -177, 14884, -136, -17, 1006, 32, -189, -402, -26, -90, 6440, 7650},
+    {6778846, 2147, -19, 14889, -137, -14, 1001, 30, -186, -409, -25, -89, 6450, 7642},
+    {6788462, 2499, 46, 14786, -133, -6, 998, 35, -185, -405, -24, -88, 6459, 7634},
+    {6798077, 2739, 92, 14659, -128, -17, 998, 25, -187, -410, -23, -87, 6468, 7626},
+    {6807692, 3110, 294, 14603, -131, -20, 998, 27, -192, -408, -22, -85, 6477, 7618},
+    {6817308, 3396, 437, 14513, -130, -11, 1000, 28, -190, -404, -20, -83, 6487, 7610},
+    {6826923, 3611, 414, 14462, -132, -11, 998, 21, -190, -406, -19, -81, 6496, 7603},
+    {6836538, 3929, 545, 14372, -131, -16, 1001, 31, -197, -399, -17, -79, 6505, 7595},
+    {6846154, 4073, 633, 14222, -131, -15, 997, 22, -191, -405, -15, -76, 6514, 7587},
+    {6855769, 4323, 894, 14165, -128, -11, 1004, 28, -202, -402, -13, -73, 6523, 7580},
+    {6865385, 4533, 767, 14077, -125, -17, 1002, 30, -194, -407, -12, -71, 6531, 7572},
+    {6875000, 4696, 865, 13909, -127, -5, 1001, 25, -198, -398, -10, -68, 6540, 7565},
+    {6884615, 4814, 1021, 13909, -130, -9, 1001, 28, -204, -402, -8, -64, 6549, 7557},
+    {6894231, 5038, 1131, 13844, -126, -10, 1005, 21, -202, -409, -6, -61, 6557, 7550},
+    {6903846, 5047, 1082, 13760, -124, -12, 995, 20, -196, -397, -3, -58, 6566, 7542},
+    {6913462, 5239, 1322, 13783, -133, -6, 1004, 29, -198, -400, -1, -54, 6575, 7535},
+    {6923077, 5435, 1343, 13464, -130, -4, 1005, 24, -199, -410, 1, -50, 6583, 7527},
+    {6932692, 5327, 1318, 13291, -124, -4, 1007, 17, -201, -403, 3, -47, 6591, 7520},
+    {6942308, 5487, 1517, 13356, -133, -2, 1004, 22, -192, -403, 5, -43, 6600, 7513},
+    {6951923, 5416, 1484, 13286, -125, -11, 995, 19, -199, -402, 7, -39, 6608, 7506},
+    {6961538, 5405, 1578, 13253, -130, 1, 999, 19, -197, -401, 9, -35, 6616, 7498},
+    {6971154, 5309, 1602, 13086, -126, -1, 1002, 17, -200, -402, 11, -31, 6624, 7491},
+    {6980769, 5298, 1651, 12922, -126, 2, 998, 28, -198, -408, 13, -27, 6632, 7484},
+    {6990385, 5156, 1821, 12936, -123, 3, 1003, 23, -200, -400, 15, -23, 6640, 7477},
+    {7000000, 5282, 1880, 12919, -125, 3, 1006, 22, -198, -396, 17, -19, 6648, 7470},
+    {7009615, 5141, 1734, 12768, -126, 0, 997, 15, -200, -400, 19, -15, 6656, 7463},
+    {7019231, 5039, 1908, 12550, -121, 3, 1000, 21, -198, -398, 21, -11, 6663, 7456},
+    {7028846, 4925, 1741, 12482, -125, -1, 1001, 15, -197, -393, 22, -8, 6671, 7450},
+    {7038462, 4710, 2005, 12437, -124, 7, 994, 20, -198, -403, 24, -4, 6679, 7443},
+    {7048077, 4535, 1946, 12265, -130, 4, 998, 18, -201, -397, 25, 0, 6686, 7436},
+    {7057692, 4339, 1984, 12151, -121, 2, 1002, 20, -202, -398, 26, 3, 6694, 7429},
+    {7067308, 4179, 1889, 12201, -118, 14, 995, 23, -197, -397, 28, 7, 6701, 7423},
+    {7076923, 4042, 1829, 11947, -125, 7, 1003, 18, -204, -398, 29, 10, 6708, 7416},
+    {7086538, 3689, 1816, 11913, -115, 0, 1006, 20, -199, -399, 30, 14, 6716, 7409},
+    {7096154, 3573, 1753, 11877, -123, 18, 1002, 26, -199, -398, 31, 17, 6723, 7403},
+    {7105769, 3309, 1871, 11630, -125, 16, 1005, 21, -206, -398, 31, 20, 6730, 7396},
+    {7115385, 3167, 1882, 11712, -124, 0, 996, 20, -208, -396, 32, 23, 6737, 7390},
+    {7125000, 2849, 1956, 11540, -121, 10, 993, 18, -201, -393, 32, 25, 6744, 7384},
+    {7134615, 2680, 1776, 11366, -120, 7, 999, 14, -211, -393, 33, 28, 6751, 7377},
+    {7144231, 2249, 1737, 11246, -112, 10, 1003, 15, -206, -392, 33, 30, 6758, 7371},
+    {7153846, 2147, 1755, 11259, -119, 14, 1000, 22, -204, -401, 33, 33, 6765, 7365},
+    {7163462, 1906, 1676, 11066, -121, 3, 998, 20, -207, -401, 33, 35, 6771, 7359},
+    {7173077, 1553, 1665, 11009, -111, 13, 995, 13, -205, -402, 32, 37, 6778, 7352},
+    {7182692, 1299, 1569, 10893, -120, 18, 999, 15, -198, -395, 32, 38, 6784, 7346},
+    {7192308, 967, 1521, 10705, -107, 9, 994, 13, -198, -398, 32, 40, 6791, 7340},
+    {7201923, 689, 1580, 10603, -114, 9, 1006, 18, -207, -400, 31, 41, 6797, 7334},
+    {7211538, 478, 1440, 10606, -114, 14, 1002, 14, -202, -401, 30, 42, 6804, 7329},
+    {7221154, 310, 1314, 10497, -109, 9, 1000, 16, -206, -402, 29, 43, 6810, 7323},
+    {7230769, 122, 1308, 10406, -111, 13, 997, 14, -203, -391, 28, 44, 6816, 7317},
+    {7240385, -26, 1180, 10379, -112, 10, 994, 14, -198, -405, 27, 45, 6822, 7311},
+    {7250000, -307, 1075, 10158, -104, 6, 994, 13, -201, -397, 26, 45, 6828, 7306},
+    {7259615, -629, 991, 9916, -104, 9, 996, 23, -207, -407, 25, 46, 6834, 7300},
+    {7269231, -651, 848, 9911, -109, 13, 1002, 19, -204, -396, 24, 46, 6840, 7294},
+    {7278846, -945, 922, 9838, -109, 5, 1005, 15, -205, -404, 22, 46, 6846, 7289},
+    {7288462, -1287, 911, 9803, -99, 13, 995, 9, -202, -406, 21, 46, 6852, 7283},
+    {7298077, -1379, 794, 9664, -108, 12, 1006, 12, -207, -401, 19, 45, 6858, 7278},
+    {7307692, -1512, 614, 9398, -102, 10, 999, 8, -201, -398, 17, 45, 6863, 7273},
+    {7317308, -1683, 452, 9291, -99, 5, 1001, 8, -197, -402, 16, 44, 6869, 7268},
+    {7326923, -1768, 512, 9153, -100, 12, 1007, 21, -204, -398, 14, 43, 6874, 7262},
+    {7336538, -2022, 330, 9150, -105, 8, 998, 8, -206, -401, 12, 42, 6880, 7257},
+    {7346154, -2072, 416, 9216, -99, 8, 997, 19, -203, -402, 11, 41, 6885, 7252},
+    {7355769, -2038, 436, 8915, -99, 5, 1000, 12, -203, -396, 9, 40, 6890, 7247},
+    {7365385, -2372, 180, 8852, -90, 5, 999, 9, -205, -392, 7, 39, 6896, 7242},
+    {7375000, -2325, 73, 8770, -93, 13, 998, 14, -205, -398, 5, 38, 6901, 7237},
+    {7384615, -2466, -118, 8582, -90, 10, 1004, 16, -202, -400, 3, 36, 6906, 7232},
+    {7394231, -2457, 13, 8491, -88, 4, 1000, 11, -200, -403, 1, 35, 6911, 7228},
+    {7403846, -2440, -131, 8471, -89, 7, 999, 11, -200, -401, 0, 33, 6916, 7223},
+    {7413462, -2438, -284, 8343, -95, 1, 996, 10, -201, -403, -2, 32, 6921, 7218},
+    {7423077, -2445, -199, 8106, -90, 7, 991, 13, -194, -395, -4, 30, 6925, 7214},
+    {7432692, -2415, -380, 8008, -86, 4, 1000, 14, -198, -398, -6, 29, 6930, 7209},
+    {7442308, -2417, -463, 7922, -83, 2, 1000, 7, -206, -400, -7, 27, 6935, 7205},
+    {7451923, -2465, -434, 7643, -89, 5, 998, 9, -200, -394, -9, 25, 6939, 7200},
+    {7461538, -2387, -468, 7563, -84, 3, 1003, 4, -198, -396, -10, 23, 6944, 7196},
+    {7471154, -2338, -677, 7443, -78, -4, 1000, 10, -198, -402, -12, 22, 6948, 7192},
+    {7480769, -2344, -614, 7432, -79, -3, 999, 14, -197, -395, -13, 20, 6952, 7188},
+    {7490385, -2312, -613, 7255, -74, -6, 1001, 11, -201, -398, -14, 18, 6957, 7184},
+    {7500000, -2065, -711, 7181, -82, 0, 1004, 3, -204, -403, -16, 16, 6961, 7179},
+    {7509615, -2070, -834, 7118, -74, 2, 1006, 10, -205, -400, -17, 14, 6965, 7175},
+    {7519231, -1691, -955, 6945, -79, -5, 997, 11, -206, -403, -18, 13, 6969, 7172},
+    {7528846, -1863, -1016, 6786, -78, -2, 999, 12, -202, -399, -19, 11, 6973, 7168},
+    {7538462, -1521, -977, 6712, -74, 2, 1001, 2, -202, -398, -20, 10, 6977, 7164},
+    {7548077, -1452, -902, 6545, -71, -3, 998, 5, -198, -401, -20, 8, 6981, 7160},
+    {7557692, -1356, -1117, 6568, -73, 3, 1008, 6, -203, -404, -21, 6, 6984, 7157},
+    {7567308, -1259, -871, 6345, -72, 0, 1002, 7, -190, -399, -22, 5, 6988, 7153},
+    {7576923, -1199, -1065, 6161, -74, -4, 991, -6, -202, -400, -22, 4, 6992, 7150},
+    {7586538, -897, -1200, 6151, -65, -11, 1004, 5, -199, -403, -23, 2, 6995, 7146},
+    {7596154, -841, -1029, 5969, -68, 1, 1003, 8, -201, -396, -23, 1, 6999, 7143},
+    {7605769, -713, -1173, 5805, -64, -2, 1004, 6, -196, -406, -23, 0, 7002, 7139},
+    {7615385, -512, -1137, 5584, -53, -8, 999, -1, -195, -397, -23, -1, 7005, 7136},
+    {7625000, -237, -1159, 5582, -64, -5, 1002, -2, -193, -398, -23, -2, 7008, 7133},
+    {7634615, -190, -1106, 5375, -54, -6, 1009, 4, -195, -400, -23, -3, 7012, 7130},
+    {7644231, -159, -1148, 5246, -66, -10, 1002, 10, -201, -403, -23, -4, 7015, 7127},
+    {7653846, 10, -1156, 5205, -54, -7, 1002, 6, -197, -400, -22, -5, 7018, 7124},
+    {7663462, 156, -1067, 4995, -53, -2, 1000, 8, -198, -402, -22, -6, 7020, 7121},
+    {7673077, 253, -1173, 4961, -47, -1, 1003, 5, -201, -399, -22, -6, 7023, 7119},
+    {7682692, 385, -1100, 4769, -45, 2, 993, -1, -205, -399, -21, -7, 7026, 7116},
+    {7692308, 696, -1203, 4682, -54, -2, 1005, 2, -198, -405, -20, -7, 7029, 7113},
+    {7701923, 618, -1039, 4723, -45, -6, 1005, 5, -203, -407, -20, -8, 7031, 7111},
+    {7711538, 844, -1070, 4386, -40, 3, 994, -2, -199, -407, -19, -8, 7034, 7108},
+    {7721154, 981, -1109, 4392, -48, -3, 1001, 2, -194, -397, -18, -8, 7036, 7106},
+    {7730769, 1026, -999, 4119, -48, -6, 996, 10, -198, -396, -18, -8, 7038, 7104},
+    {7740385, 1212, -1129, 4130, -40, -4, 1002, 5, -194, -392, -17, -8, 7041, 7101},
+    {7750000, 1229, -1038, 3917, -38, -3, 999, 3, -197, -398, -16, -8, 7043, 7099},
+    {7759615, 1183, -972, 3848, -32, 0, 998, -4, -199, -395, -15, -8, 7045, 7097},
+    {7769231, 1358, -1007, 3689, -34, 0, 1001, 3, -203, -388, -14, -8, 7047, 7095},
+    {7778846, 1448, -882, 3605, -34, -3, 992, 0, -199, -406, -13, -8, 7049, 7093},
+    {7788462, 1388, -824, 3218, -38, -6, 1003, 1, -199, -396, -12, -8, 7051, 7091},
+    {7798077, 1417, -877, 3228, -29, -3, 1005, 10, -202, -406, -11, -8, 7053, 7089},
+    {7807692, 1518, -789, 2996, -31, -3, 1007, -3, -193, -393, -10, -7, 7054, 7088},
+    {7817308, 1498, -823, 2983, -26, 1, 997, 1, -202, -400, -9, -7, 7056, 7086},
+    {7826923, 1473, -704, 2806, -23, 7, 1011, -7, -200, -404, -8, -7, 7057, 7085},
+    {7836538, 1492, -589, 2703, -22, -6, 1007, 8, -203, -402, -7, -6, 7059, 7083},
+    {7846154, 1549, -672, 2635, -23, 2, 1008, -5, -196, -397, -6, -6, 7060, 7082},
+    {7855769, 1472, -646, 2368, -22, 1, 1002, 2, -202, -398, -6, -5, 7062, 7081},
+    {7865385, 1423, -592, 2355, -19, -6, 1002, -2, -200, -396, -5, -5, 7063, 7079},
+    {7875000, 1466, -554, 2158, -20, -3, 998, 2, -200, -403, -4, -5, 7064, 7078},
+    {7884615, 1310, -556, 2022, -24, 6, 997, -5, -199, -396, -3, -4, 7065, 7077},
+    {7894231, 1378, -350, 1896, -17, 1, 994, 0, -196, -396, -3, -4, 7066, 7076},
+    {7903846, 1301, -471, 1621, -20, 1, 1003, 2, -205, -401, -2, -3, 7067, 7075},
+    {7913462, 1096, -389, 1626, -10, 7, 995, -1, -201, -404, -1, -3, 7068, 7074},
+    {7923077, 1076, -312, 1463, -15, -4, 998, -1, -195, -398, -1, -2, 7068, 7074},
+    {7932692, 998, -110, 1190, -13, 0, 997, 11, -199, -405, -1, -2, 7069, 7073},
+    {7942308, 822, -249, 1129, -8, 0, 997, -2, -196, -406, 0, -2, 7070, 7073},
+    {7951923, 807, -78, 1024, -4, 2, 1005, -3, -198, -402, 0, -1, 7070, 7072},
+    {7961538, 687, -47, 822, -13, 0, 993, 0, -200, -400, 0, -1, 7070, 7072},
+    {7971154, 776, -65, 735, -4, -6, 999, 1, -197, -394, 0, -1, 7071, 7071},
+    {7980769, 514, -97, 510, 5, 3, 1000, 3, -199, -403, 0, 0, 7071, 7071},
+    {7990385, 476, 0, 480, -3, 5, 1001, 1, -198, -399, 0, 0, 7071, 7071},
+    {8000000, 457, -99, 348, 2, 3, 1000, -3, -203, -398, 0, 0, 7071, 7071},
+    {8009615, 377, -345, 161, 9, 0, 1000, 3, -198, -398, 0, 0, 7071, 7071},
+    {8019231, 423, -228, 307, -1, 16, 1001, -2, -201, -402, 0, 0, 7071, 7071},
+    {8028846, 486, -316, 198, -2, -6, 999, 6, -199, -407, 0, 0, 7071, 7071},
+    {8038462, 438, -193, 398, 1, 2, 1005, -3, -208, -405, 0, 0, 7071, 7071},
+    {8048077, 413, -184, 280, -6, 3, 993, -2, -202, -400, 0, 0, 7071, 7071},
+    {8057692, 433, -187, 277, 1, -5, 1004, 1, -204, -402, 0, 0, 7071, 7071},
+    {8067308, 417, -243, 281, -2, 4, 999, -2, -201, -404, 0, 0, 7071, 7071},
+    {8076923, 432, -281, 328, -11, 0, 1000, 3, -197, -399, 0, 0, 7071, 7071},
+    {8086538, 415, -294, 253, 0, -2, 994, -7, -205, -398, 0, 0, 7071, 7071},
+    {8096154, 421, -204, 231, 1, -7, 1002, 10, -202, -401, 0, 0, 7071, 7071},
+    {8105769, 444, -329, 195, 3, 0, 996, -3, -194, -403, 0, 0, 7071, 7071},
+    {8115385, 389, -295, 288, 3, 1, 1001, -4, -199, -399, 0, 0, 7071, 7071},
+    {8125000, 345, -186, 240, -2, -5, 1003, -2, -203, -400, 0, 0, 7071, 7071},
+    {8134615, 358, -248, 401, -5, -8, 1001, -4, -198, -403, 0, 0, 7071, 7071},
+    {8144231, 393, -235, 242, 1, 6, 1007, 0, -200, -403, 0, 0, 7071, 7071},
+    {8153846, 448, -264, 288, -1, 3, 995, 2, -198, -398, 0, 0, 7071, 7071},
+    {8163462, 244, -238, 231, 3, 1, 1002, -1, -198, -391, 0, 0, 7071, 7071},
+    {8173077, 412, -123, 344, 4, -7, 998, -1, -202, -401, 0, 0, 7071, 7071},
+    {8182692, 324, -270, 254, -7, 2, 997, 0, -198, -408, 0, 0, 7071, 7071},
+    {8192308, 436, -334, 195, -4, -7, 1001, 1, -198, -397, 0, 0, 7071, 7071},
+    {8201923, 423, -276, 372, -7, -1, 997, 3, -192, -396, 0, 0, 7071, 7071},
+    {8211538, 406, -227, 369, 1, -6, 997, 4, -197, -395, 0, 0, 7071, 7071},
+    {8221154, 392, -341, 251, 0, 3, 1001, -4, -197, -399, 0, 0, 7071, 7071},
+    {8230769, 288, -153, 424, -1, -5, 999, 6, -207, -400, 0, 0, 7071, 7071},
+    {8240385, 536, -297, 368, 0, -8, 1005, -2, -198, -401, 0, 0, 7071, 7071},
+    {8250000, 486, -269, 174, -1, 3, 1000, -6, -201, -400, 0, 0, 7071, 7071},
+    {8259615, 388, -388, 328, 1, 7, 998, 5, -201, -399, 0, 0, 7071, 7071},
+    {8269231, 379, -254, 342, 3, -1, 997, -3, -202, -401, 0, 0, 7071, 7071},
+    {8278846, 370, -285, 311, 0, 3, 1006, 2, -200, -405, 0, 0, 7071, 7071},
+    {8288462, 409, -274, 311, 1, -1, 1003, -3, -189, -402, 0, 0, 7071, 7071},
+    {8298077, 480, -218, 379, 6, -2, 1003, 2, -200, -398, 0, 0, 7071, 7071},
+    {8307692, 554, -311, 279, -4, 2, 998, -1, -202, -409, 0, 0, 7071, 7071},
+    {8317308, 404, -312, 238, -7, -1, 1002, 0, -200, -402, 0, 0, 7071, 7071},
+    {8326923, 365, -187, 294, -3, -5, 999, 10, -200, -400, 0, 0, 7071, 7071},
+    {8336538, 433, -280, 474, -9, 5, 1000, -3, -196, -402, 0, 0, 7071, 7071},
+    {8346154, 463, -242, 427, 9, -5, 996, -3, -200, -398, 0, 0, 7071, 7071},
+    {8355769, 345, -317, 406, 4, 2, 1000, 5, -204, -402, 0, 0, 7071, 7071},
+    {8365385, 432, -133, 360, 0, 3, 1004, 3, -203, -402, 0, 0, 7071, 7071},
+    {8375000, 514, -313, 262, 0, 7, 998, -3, -194, -393, 0, 0, 7071, 7071},
+    {8384615, 363, -191, 159, -2, 0, 998, 3, -199, -398, 0, 0, 7071, 7071},
+    {8394231, 402, -253, 371, 2, -9, 998, 2, -203, -398, 0, 0, 7071, 7071},
+    {8403846, 381, -135, 339, -9, -3, 997, 0, -202, -402, 0, 0, 7071, 7071},
+    {8413462, 342, -269, 252, 0, 2, 997, -8, -198, -397, 0, 0, 7071, 7071},
+    {8423077, 448, -186, 456, -2, -3, 999, -5, -199, -399, 0, 0, 7071, 7071},
+    {8432692, 433, -199, 327, 5, -6, 995, 0, -200, -399, 0, 0, 7071, 7071},
+    {8442308, 372, -301, 215, 0, -4, 1000, -7, -200, -399, 0, 0, 7071, 7071},
+    {8451923, 402, -257, 357, 6, -5, 995, 3, -207, -399, 0, 0, 7071, 7071},
+    {8461538, 313, -340, 296, 0, -1, 1005, -1, -199, -401, 0, 0, 7071, 7071},
+    {8471154, 333, -261, 221, -6, 2, 1000, -3, -202, -400, 0, 0, 7071, 7071},
+    {8480769, 402, -346, 169, -3, -1, 1002, 6, -205, -394, 0, 0, 7071, 7071},
+    {8490385, 367, -224, 427, -1, -5, 1000, -9, -200, -404, 0, 0, 7071, 7071},
+    {8500000, 435, -255, 419, -2, -2, 996, -3, -202, -400, 0, 0, 7071, 7071},
+    {8509615, 463, -159, 306, 11, 3, 991, -1, -200, -396, 0, 0, 7071, 7071},
+    {8519231, 348, -280, 402, -5, 3, 996, 0, -198, -406, 0, 0, 7071, 7071},
+    {8528846, 376, -292, 351, -2, 1, 998, 5, -205, -401, 0, 0, 7071, 7071},
+    {8538462, 344, -227, 112, -4, 0, 998, -5, -201, -401, 0, 0, 7071, 7071},
+    {8548077, 326, -276, 311, -1, 3, 1004, 6, -194, -405, 0, 0, 7071, 7071},
+    {8557692, 427, -292, 384, 2, -5, 1000, 5, -199, -396, 0, 0, 7071, 7071},
+    {8567308, 479, -219, 159, -4, 5, 1002, 9, -202, -404, 0, 0, 7071, 7071},
+    {8576923, 486, -279, 269, 3, -1, 1001, 2, -205, -394, 0, 0, 7071, 7071},
+    {8586538, 388, -293, 319, 6, -2, 998, -1, -207, -399, 0, 0, 7071, 7071},
+    {8596154, 417, -217, 375, -2, 6, 1004, -1, -191, -403, 0, 0, 7071, 7071},
+    {8605769, 296, -259, 129, -3, 3, 1011, 1, -206, -402, 0, 0, 7071, 7071},
+    {8615385, 381, -274, 385, 3, 0, 1010, 1, -195, -399, 0, 0, 7071, 7071},
+    {8625000, 458, -269, 254, 2, -6, 994, -1, -194, -403, 0, 0, 7071, 7071},
+    {8634615, 358, -286, 323, 0, 7, 999, -6, -196, -396, 0, 0, 7071, 7071},
+    {8644231, 355, -317, 386, 3, -2, 999, 5, -200, -399, 0, 0, 7071, 7071},
+    {8653846, 268, -291, 396, -7, 3, 1002, -4, -194, -401, 0, 0, 7071, 7071},
+    {8663462, 519, -251, 287, 2, -1, 999, 2, -202, -405, 0, 0, 7071, 7071},
+    {8673077, 433, -149, 382, -4, -2, 1003, -1, -200, -408, 0, 0, 7071, 7071},
+    {8682692, 434, -309, 234, 2, -4, 1001, 10, -195, -397, 0, 0, 7071, 7071},
+    {8692308, 391, -208, 468, -1, 3, 1003, 8, -207, -400, 0, 0, 7071, 7071},
+    {8701923, 462, -243, 329, 4, -3, 998, -5, -202, -398, 0, 0, 7071, 7071},
+    {8711538, 472, -387, 234, -2, 1, 1002, -8, -201, -398, 0, 0, 7071, 7071},
+    {8721154, 462, -370, 263, 1, 3, 1002, -3, -195, -404, 0, 0, 7071, 7071},
+    {8730769, 299, -264, 324, 0, 1, 998, -2, -198, -400, 0, 0, 7071, 7071},
+    {8740385, 281, -198, 249, -6, 4, 999, 3, -201, -404, 0, 0, 7071, 7071},
+    {8750000, 440, -292, 272, 4, 0, 994, -2, -195, -406, 0, 0, 7071, 7071},
+    {8759615, 328, -170, 435, -3, -2, 1001, -2, -199, -399, 0, 0, 7071, 7071},
+    {8769231, 279, -119, 313, 1, 0, 997, 0, -201, -396, 0, 0, 7071, 7071},
+    {8778846, 473, -261, 436, 2, 4, 1000, 1, -204, -394, 0, 0, 7071, 7071},
+    {8788462, 362, -369, 238, -5, 3, 999, -2, -200, -400, 0, 0, 7071, 7071},
+    {8798077, 595, -275, 220, -3, -4, 1002, 1, -203, -397, 0, 0, 7071, 7071},
+    {8807692, 349, -198, 265, -8, 9, 989, 2, -195, -400, 0, 0, 7071, 7071},
+    {8817308, 330, -188, 199, -1, -5, 1001, -1, -198, -401, 0, 0, 7071, 7071},
+    {8826923, 429, -230, 200, -7, -3, 999, 0, -201, -404, 0, 0, 7071, 7071},
+    {8836538, 352, -230, 386, 0, 4, 999, 4, -199, -394, 0, 0, 7071, 7071},
+    {8846154, 484, -323, 266, -2, -4, 1002, -6, -204, -403, 0, 0, 7071, 7071},
+    {8855769, 541, -308, 470, 1, -1, 1002, -2, -195, -400, 0, 0, 7071, 7071},
+    {8865385, 436, -171, 290, -2, 2, 996, -3, -209, -397, 0, 0, 7071, 7071},
+    {8875000, 308, -240, 342, -1, -1, 1006, 2, -206, -401, 0, 0, 7071, 7071},
+    {8884615, 332, -361, 270, 3, -6, 998, 0, -196, -401, 0, 0, 7071, 7071},
+    {8894231, 466, -147, 393, -2, 7, 995, 6, -204, -402, 0, 0, 7071, 7071},
+    {8903846, 476, -117, 285, 3, 2, 1009, -1, -199, -398, 0, 0, 7071, 7071},
+    {8913462, 455, -280, 266, 8, -3, 1005, 0, -197, -410, 0, 0, 7071, 7071},
+    {8923077, 382, -207, 362, -4, 4, 1005, -4, -198, -397, 0, 0, 7071, 7071},
+    {8932692, 438, -381, 204, 4, -1, 1004, 3, -197, -395, 0, 0, 7071, 7071},
+    {8942308, 437, -207, 287, 5, -5, 1000, -1, -203, -397, 0, 0, 7071, 7071},
+    {8951923, 264, -372, 326, -3, -3, 996, -3, -196, -399, 0, 0, 7071, 7071},
+    {8961538, 413, -332, 199, 10, 3, 1005, -4, -198, -398, 0, 0, 7071, 7071},
+    {8971154, 403, -208, 270, 4, 2, 989, -2, -198, -402, 0, 0, 7071, 7071},
+    {8980769, 498, -218, 207, 4, 2, 998, 2, -198, -396, 0, 0, 7071, 7071},
+    {8990385, 369, -194, 226, -2, -5, 1004, 1, -198, -400, 0, 0, 7071, 7071},
+    {9000000, 353, -270, 338, 4, -9, 994, 2, -203, -406, 0, 0, 7071, 7071},
+    {9009615, 384, -247, 231, -1, 0, 997, 1, -201, -398, 0, 0, 7071, 7071},
+    {9019231, 384, -278, 296, -7, 7, 993, -7, -202, -398, 0, 0, 7071, 7071},
+    {9028846, 432, -290, 319, 4, -3, 1000, 3, -202, -407, 0, 0, 7071, 7071},
+    {9038462, 267, -325, 322, -4, -1, 999, 7, -197, -400, 0, 0, 7071, 7071},
+    {9048077, 422, -203, 300, -1, 2, 1005, 3, -202, -404, 0, 0, 7071, 7071},
+    {9057692, 316, -135, 356, 1, 0, 1003, -3, -194, -401, 0, 0, 7071, 7071},
+    {9067308, 359, -217, 409, 4, -3, 998, 1, -203, -405, 0, 0, 7071, 7071},
+    {9076923, 353, -231, 441, 1, -7, 1000, 2, -202, -396, 0, 0, 7071, 7071},
+    {9086538, 388, -209, 357, 2, 2, 999, -5, -208, -393, 0, 0, 7071, 7071},
+    {9096154, 547, -284, 288, 1, -2, 994, 2, -201, -401, 0, 0, 7071, 7071},
+    {9105769, 436, -332, 175, 3, 2, 994, -3, -202, -403, 0, 0, 7071, 7071},
+    {9115385, 326, -135, 361, -1, 4, 994, -5, -202, -404, 0, 0, 7071, 7071},
+    {9125000, 356, -323, 355, 6, 4, 1004, 0, -201, -393, 0, 0, 7071, 7071},
+    {9134615, 343, -297, 330, 4, -4, 999, 0, -201, -403, 0, 0, 7071, 7071},
+    {9144231, 370, -360, 329, 6, 7, 1005, 1, -200, -399, 0, 0, 7071, 7071},
+    {9153846, 535, -351, 294, -2, 5, 1006, 2, -202, -396, 0, 0, 7071, 7071},
+    {9163462, 402, -266, 264, -5, -5, 995, 6, -204, -396, 0, 0, 7071, 7071},
+    {9173077, 387, -431, 179, 2, -1, 1005, -2, -211, -396, 0, 0, 7071, 7071},
+    {9182692, 548, -254, 252, -1, -8, 999, -6, -200, -402, 0, 0, 7071, 7071},
+    {9192308, 528, -318, 284, -1, -1, 1006, -1, -199, -397, 0, 0, 7071, 7071},
+    {9201923, 466, -141, 311, 2, -1, 1000, 0, -202, -403, 0, 0, 7071, 7071},
+    {9211538, 333, -186, 420, 2, -4, 1003, -2, -195, -394, 0, 0, 7071, 7071},
+    {9221154, 455, -284, 324, 2, 3, 999, -1, -200, -398, 0, 0, 7071, 7071},
+    {9230769, 387, -292, 310, 1, -1, 1000, -1, -204, -399, 0, 0, 7071, 7071},
+    {9240385, 433, -245, 210, -3, -3, 1007, 2, -200, -404, 0, 0, 7071, 7071},
+    {9250000, 389, -318, 372, 4, 6, 1002, -2, -196, -398, 0, 0, 7071, 7071},
+    {9259615, 479, -283, 336, -1, 3, 1003, -4, -206, -402, 0, 0, 7071, 7071},
+    {9269231, 522, -178, 336, 3, 4, 1006, 0, -204, -399, 0, 0, 7071, 7071},
+    {9278846, 290, -194, 228, 6, 4, 1000, -5, -201, -399, 0, 0, 7071, 7071},
+    {9288462, 466, -203, 216, 11, 1, 995, 5, -201, -400, 0, 0, 7071, 7071},
+    {9298077, 391, -374, 281, -5, 1, 1002, -2, -202, -402, 0, 0, 7071, 7071},
+    {9307692, 366, -89, 195, 1, 0, 995, 4, -192, -405, 0, 0, 7071, 7071},
+    {9317308, 270, -278, 211, -4, -5, 1010, -2, -196, -398, 0, 0, 7071, 7071},
+    {9326923, 487, -145, 273, -6, -2, 1005, -4, -199, -404, 0, 0, 7071, 7071},
+    {9336538, 380, -231, 448, -7, 2, 1005, 1, -195, -399, 0, 0, 7071, 7071},
+    {9346154, 285, -211, 388, 6, 5, 996, -5, -201, -405, 0, 0, 7071, 7071},
+    {9355769, 434, -393, 369, 7, -5, 1000, 1, -197, -398, 0, 0, 7071, 7071},
+    {9365385, 358, -276, 394, 3, -1, 1008, -1, -197, -401, 0, 0, 7071, 7071},
+    {9375000, 356, -400, 488, 1, -7, 1000, -2, -196, -398, 0, 0, 7071, 7071},
+    {9384615, 485, -283, 250, 0, 1, 999, 0, -195, -397, 0, 0, 7071, 7071},
+    {9394231, 381, -255, 312, 7, 6, 1001, -2, -197, -402, 0, 0, 7071, 7071},
+    {9403846, 317, -264, 338, -1, 2, 1002, 9, -207, -404, 0, 0, 7071, 7071},
+    {9413462, 326, -205, 263, -2, -2, 993, -2, -197, -402, 0, 0, 7071, 7071},
+    {9423077, 478, -238, 299, -1, -1, 999, -7, -196, -403, 0, 0, 7071, 7071},
+    {9432692, 349, -123, 272, -3, -3, 1001, -6, -194, -397, 0, 0, 7071, 7071},
+    {9442308, 406, -267, 340, -6, -4, 1003, 1, -200, -406, 0, 0, 7071, 7071},
+    {9451923, 396, -466, 397, -4, 0, 1006, -5, -197, -405, 0, 0, 7071, 7071},
+    {9461538, 411, -332, 353, -6, 0, 995, 9, -198, -401, 0, 0, 7071, 7071},
+    {9471154, 525, -153, 329, 5, 1, 1002, 0, -197, -402, 0, 0, 7071, 7071},
+    {9480769, 409, -26, 330, -2, -2, 1005, 1, -196, -398, 0, 0, 7071, 7071},
+    {9490385, 529, -181, 304, 0, 3, 994, 4, -196, -401, 0, 0, 7071, 7071},
+    {9500000, 441, -244, 318, 3, 3, 995, -5, -203, -398, 0, 0, 7071, 7071},
+    {9509615, 399, -246, 253, 2, 2, 997, -3, -204, -403, 0, 0, 7071, 7071},
+    {9519231, 482, -182, 343, -1, -1, 992, -1, -195, -410, 0, 0, 7071, 7071},
+    {9528846, 411, -244, 359, -7, -6, 1001, -4, -192, -398, 0, 0, 7071, 7071},
+    {9538462, 419, -106, 335, -4, -5, 997, 6, -206, -398, 0, 0, 7071, 7071},
+    {9548077, 391, -229, 319, 5, -1, 1003, -3, -195, -403, 0, 0, 7071, 7071},
+    {9557692, 389, -313, 424, 2, -2, 996, 3, -198, -404, 0, 0, 7071, 7071},
+    {9567308, 427, -181, 468, 2, -2, 1002, 10, -202, -398, 0, 0, 7071, 7071},
+    {9576923, 423, -257, 471, 3, -3, 998, 0, -195, -402, 0, 0, 7071, 7071},
+    {9586538, 403, -386, 210, 4, 2, 993, -8, -198, -401, 0, 0, 7071, 7071},
+    {9596154, 326, -229, 171, 4, 4, 1003, -3, -204, -397, 0, 0, 7071, 7071},
+    {9605769, 435, -300, 286, 2, -2, 995, 1, -202, -397, 0, 0, 7071, 7071},
+    {9615385, 416, -315, 368, 0, -2, 995, 1, -203, -398, 0, 0, 7071, 7071},
+    {9625000, 448, -289, 259, 6, 2, 1000, 0, -201, -404, 0, 0, 7071, 7071},
+    {9634615, 471, -224, 272, -4, -6, 997, 3, -201, -399, 0, 0, 7071, 7071},
+    {9644231, 383, -350, 277, 0, -4, 1004, -7, -201, -400, 0, 0, 7071, 7071},
+    {9653846, 384, -297, 277, 0, -4, 999, 7, -198, -404, 0, 0, 7071, 7071},
+    {9663462, 376, -267, 275, 2, -1, 1004, 5, -202, -401, 0, 0, 7071, 7071},
+    {9673077, 358, -198, 354, 0, -3, 1003, 6, -199, -396, 0, 0, 7071, 7071},
+    {9682692, 401, -339, 323, -1, -9, 1008, -7, -198, -398, 0, 0, 7071, 7071},
+    {9692308, 458, -197, 293, -2, -6, 999, -2, -202, -398, 0, 0, 7071, 7071},
+    {9701923, 393, -261, 256, 3, 6, 1001, 0, -196, -394, 0, 0, 7071, 7071},
+    {9711538, 402, -247, 243, 9, 2, 1002, 10, -200, -401, 0, 0, 7071, 7071},
+    {9721154, 374, -230, 277, 9, -6, 1006, 5, -199, -396, 0, 0, 7071, 7071},
+    {9730769, 392, -233, 224, 5, 4, 994, -1, -203, -402, 0, 0, 7071, 7071},
+    {9740385, 410, -267, 383, 2, -1, 1000, -1, -196, -395, 0, 0, 7071, 7071},
+    {9750000, 327, -137, 197, 4, 4, 1001, -2, -201, -396, 0, 0, 7071, 7071},
+    {9759615, 513, -426, 305, -8, -7, 1007, 5, -208, -399, 0, 0, 7071, 7071},
+    {9769231, 470, -194, 386, 5, -2, 994, -1, -209, -406, 0, 0, 7071, 7071},
+    {9778846, 340, -296, 342, 1, 2, 1000, 3, -193, -395, 0, 0, 7071, 7071},
+    {9788462, 535, -269, 230, 6, 0, 1003, -3, -200, -399, 0, 0, 7071, 7071},
+    {9798077, 374, -276, 298, -1, -4, 999, -8, -196, -405, 0, 0, 7071, 7071},
+    {9807692, 389, -199, 279, 6, -1, 1000, 2, -204, -403, 0, 0, 7071, 7071},
+    {9817308, 343, -219, 380, 4, -5, 991, 3, -199, -404, 0, 0, 7071, 7071},
+    {9826923, 318, -291, 294, -2, 0, 993, -3, -203, -397, 0, 0, 7071, 7071},
+    {9836538, 410, -272, 267, -5, -5, 999, -1, -198, -400, 0, 0, 7071, 7071},
+    {9846154, 464, -170, 440, 3, 2, 995, -2, -200, -397, 0, 0, 7071, 7071},
+    {9855769, 483, -282, 260, -1, 1, 1003, -6, -200, -406, 0, 0, 7071, 7071},
+    {9865385, 455, -218, 222, 5, -10, 999, -5, -206, -404, 0, 0, 7071, 7071},
+    {9875000, 440, -157, 439, -4, -3, 995, -2, -206, -399, 0, 0, 7071, 7071},
+    {9884615, 334, -58, 359, 3, 1, 1000, -4, -205, -398, 0, 0, 7071, 7071},
+    {9894231, 466, -294, 263, 6, -1, 1002, -1, -201, -400, 0, 0, 7071, 7071},
+    {9903846, 467, -214, 349, 11, 8, 1003, 2, -201, -399, 0, 0, 7071, 7071},
+    {9913462, 448, -326, 351, 4, 3, 1001, -3, -199, -397, 0, 0, 7071, 7071},
+    {9923077, 353, -280, 254, 1, -1, 999, -12, -192, -400, 0, 0, 7071, 7071},
+    {9932692, 316, -346, 223, 1, 0, 1002, 0, -204, -398, 0, 0, 7071, 7071},
+    {9942308, 323, -296, 273, -4, 0, 999, -6, -195, -397, 0, 0, 7071, 7071},
+    {9951923, 514, -225, 281, -6, 4, 1003, 1, -193, -399, 0, 0, 7071, 7071},
+    {9961538, 481, -208, 237, -5, 4, 997, 6, -203, -399, 0, 0, 7071, 7071},
+    {9971154, 447, -217, 354, 1, 0, 1002, -1, -197, -401, 0, 0, 7071, 7071},
+    {9980769, 217, -280, 308, 1, 4, 997, 1, -195, -406, 0, 0, 7071, 7071},
+    {9990385, 481, -295, 299, 1, -3, 1007, -2, -198, -391, 0, 0, 7071, 7071},
+};
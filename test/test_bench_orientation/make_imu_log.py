@@ -0,0 +1,159 @@
+"""
+Writes imu_log.h, a synthetic IMU log for test_bench_orientation.
+
+There is no recording from the car yet, so this simulates one: 2s at rest
+facing north, a 90 degree left turn over 6s with the body rocking and the
+car speeding up then braking, then 2s at rest facing west. Sensor units
+match what the drivers hand to main.cpp (mdps, mg, mgauss) with white noise,
+a gyro bias that wanders, and int16 quantization. Rates stay inside the
++-32.7dps an int16 of mdps can hold. The true orientation is
+logged as a quaternion (x, y, z, w) scaled by 10000.
+
+Regenerate with `python3 make_imu_log.py > imu_log.h`, the seed is fixed.
+"""
+import math
+import random
+
+RATE_HZ = 104
+DURATION_S = 10.0
+REST_S = 2.0
+TURN_S = 6.0
+
+# Earth field in the world frame (x north, z up), gauss, dipping down
+EARTH_FIELD = (0.20, 0.0, -0.40)
+
+GYRO_NOISE_MDPS = 70.0
+GYRO_BIAS_MDPS = (400.0, -250.0, 300.0)
+GYRO_BIAS_WALK_MDPS = 2.0
+ACCEL_NOISE_MG = 4.0
+MAGNO_NOISE_MGAUSS = 4.0
+
+
+def q_mul(a, b):
+    ax, ay, az, aw = a
+    bx, by, bz, bw = b
+    return (aw * bx + ax * bw + ay * bz - az * by,
+            aw * by - ax * bz + ay * bw + az * bx,
+            aw * bz + ax * by - ay * bx + az * bw,
+            aw * bw - ax * bx - ay * by - az * bz)
+
+
+def q_conj(q):
+    return (-q[0], -q[1], -q[2], q[3])
+
+
+def q_rotate(q, v):
+    r = q_mul(q_mul(q, (v[0], v[1], v[2], 0.0)), q_conj(q))
+    return r[:3]
+
+
+def q_from_euler(roll, pitch, yaw):
+    cr, sr = math.cos(roll / 2), math.sin(roll / 2)
+    cp, sp = math.cos(pitch / 2), math.sin(pitch / 2)
+    cy, sy = math.cos(yaw / 2), math.sin(yaw / 2)
+    return (sr * cp * cy - cr * sp * sy,
+            cr * sp * cy + sr * cp * sy,
+            cr * cp * sy - sr * sp * cy,
+            cr * cp * cy + sr * sp * sy)
+
+
+def smoothstep(x):
+    x = min(max(x, 0.0), 1.0)
+    return x * x * (3 - 2 * x)
+
+
+def orientation(t):
+    """Body to world rotation at time t"""
+    turn = (t - REST_S) / TURN_S
+    yaw = math.pi / 2 * smoothstep(turn)
+    rocking = math.sin(math.pi * min(max(turn, 0.0), 1.0))
+    roll = math.radians(1.5) * rocking * math.sin(2 * math.pi * 1.0 * t)
+    pitch = math.radians(1) * rocking * math.sin(2 * math.pi * 0.7 * t)
+    return q_from_euler(roll, pitch, yaw)
+
+
+def forward_accel(t):
+    """Along-track acceleration in g, speeding up then braking"""
+    turn = (t - REST_S) / TURN_S
+    if turn <= 0 or turn >= 1:
+        return 0.0
+    return 0.15 * math.sin(2 * math.pi * turn)
+
+
+def body_rates(t, dt=1e-5):
+    """Body rates in rad/s from w = 2 q* dq/dt"""
+    q0 = orientation(t - dt)
+    q1 = orientation(t + dt)
+    q = orientation(t)
+    dq = tuple((b - a) / (2 * dt) for a, b in zip(q0, q1))
+    w = q_mul(q_conj(q), dq)
+    return tuple(2 * c for c in w[:3])
+
+
+def clamp_int16(value):
+    return max(-32768, min(32767, int(round(value))))
+
+
+def main():
+    random.seed(1234)
+    bias = list(GYRO_BIAS_MDPS)
+    lines = []
+    for i in range(int(RATE_HZ * DURATION_S)):
+        t = i / RATE_HZ
+        q = orientation(t)
+        q_inv = q_conj(q)
+
+        rates = body_rates(t)
+        for axis in range(3):
+            bias[axis] += random.gauss(0, GYRO_BIAS_WALK_MDPS / RATE_HZ)
+        gyro = [clamp_int16(math.degrees(rates[axis]) * 1000 + bias[axis] +
+                            random.gauss(0, GYRO_NOISE_MDPS))
+                for axis in range(3)]
+
+        # Specific force, gravity plus the car's own acceleration along its
+        # heading, both seen from the body
+        yaw = math.pi / 2 * smoothstep((t - REST_S) / TURN_S)
+        a = forward_accel(t)
+        world_force = (a * math.cos(yaw), a * math.sin(yaw), 1.0)
+        force = q_rotate(q_inv, world_force)
+        accel = [clamp_int16(force[axis] * 1000 +
+                             random.gauss(0, ACCEL_NOISE_MG))
+                 for axis in range(3)]
+
+        field = q_rotate(q_inv, EARTH_FIELD)
+        magno = [clamp_int16(field[axis] * 1000 +
+                             random.gauss(0, MAGNO_NOISE_MGAUSS))
+                 for axis in range(3)]
+
+        truth = [clamp_int16(c * 10000) for c in q]
+        lines.append("    {%s}," % ", ".join(
+            "%d" % v for v in [int(round(t * 1e6))] + gyro + accel + magno +
+            truth))
+
+    print("#pragma once")
+    print("")
+    print("/**")
+    print(" * Synthetic IMU log written by make_imu_log.py, not a recording.")
+    print(" * See the script for the motion and the noise model.")
+    print("*/")
+    print("#include <stdint.h>")
+    print("")
+    print("#define IMU_LOG_RATE_HZ %d" % RATE_HZ)
+    print("#define IMU_LOG_REST_SAMPLES %d" % int(RATE_HZ * REST_S))
+    print("")
+    print("typedef struct {")
+    print("    uint32_t timestamp_us;")
+    print("    int16_t gyro[3];       // mdps")
+    print("    int16_t accel[3];      // mg")
+    print("    int16_t magno[3];      // mgauss")
+    print("    int16_t truth[4];      // x, y, z, w * 10000")
+    print("} imu_log_entry_t;")
+    print("")
+    print("static const imu_log_entry_t IMU_LOG[] = {")
+    for line in lines:
+        print(line)
+    print("};")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,155 @@
+/**
+ * Replays imu_log.h through each OrientationFilter and reports the cost of an
+ * update and how far the orientation drifts from the logged truth. The log is
+ * synthetic (see make_imu_log.py), swap in a recording when there is one.
+*/
+#include <math.h>
+#include <unity.h>
+
+#include <memory>
+#include <vector>
+
+#include "../bench.h"
+#include "imu_log.h"
+#include "math/conversion.h"
+#include "math/orientation_filter.h"
+
+using namespace SimpleSlam::Math;
+
+#define NUM_ENTRIES (sizeof(IMU_LOG) / sizeof(IMU_LOG[0]))
+
+// Replays of the whole log timed per filter
+#define BENCH_REPLAYS (BENCH_ITERATIONS / NUM_ENTRIES + 1)
+
+typedef struct {
+    Vector3 angular_velocity;  // rad/s, calibrated gyro offset removed
+    Vector3 force;             // g
+    Vector3 magno;             // gauss
+    Quaternion truth;
+    double time_delta;
+} replay_entry_t;
+
+typedef struct {
+    double cost;         // BENCH_UNIT per update
+    double final_error;  // degrees
+    double max_error;    // degrees, after the initial rest
+} replay_result_t;
+
+static std::vector<replay_entry_t> entries;
+
+static Vector3 to_vector(const int16_t* values, double scale) {
+    return Vector3(values[0] * scale, values[1] * scale, values[2] * scale);
+}
+
+/**
+ * Convert the log the way main.cpp does, gyro offset from the initial rest
+ * as the startup calibration takes it
+ */
+static void load_log() {
+    Vector3 gyro_offset(0, 0, 0);
+    for (size_t i = 0; i < IMU_LOG_REST_SAMPLES; i++) {
+        gyro_offset = gyro_offset + to_vector(IMU_LOG[i].gyro, pi / 180000);
+    }
+    gyro_offset = gyro_offset * (1.0 / IMU_LOG_REST_SAMPLES);
+
+    entries.clear();
+    for (size_t i = 0; i < NUM_ENTRIES; i++) {
+        const imu_log_entry_t& entry = IMU_LOG[i];
+        const int16_t* t = entry.truth;
+        const uint32_t elapsed_us =
+            i == 0 ? 1000000 / IMU_LOG_RATE_HZ
+                   : entry.timestamp_us - IMU_LOG[i - 1].timestamp_us;
+        entries.push_back(
+            {to_vector(entry.gyro, pi / 180000) - gyro_offset,
+             to_vector(entry.accel, 1.0 / 1000),
+             to_vector(entry.magno, 1.0 / 1000),
+             Quaternion(t[0] / 1e4, t[1] / 1e4, t[2] / 1e4, t[3] / 1e4)
+                 .normalize(),
+             elapsed_us / 1e6});
+    }
+}
+
+/** Angle of the rotation between two unit quaternions, degrees */
+static double angle_between(const Quaternion& a, const Quaternion& b) {
+    const double dot = fabs(a.x() * b.x() + a.y() * b.y() + a.z() * b.z() +
+                            a.w() * b.w());
+    return 2 * acos(fmin(dot, 1.0)) * 180 / pi;
+}
+
+static replay_result_t replay(OrientationFilter& filter, const char* name) {
+    replay_result_t result{0, 0, 0};
+
+    Quaternion q;
+    for (size_t i = 0; i < entries.size(); i++) {
+        const replay_entry_t& entry = entries[i];
+        q = filter.update(q, entry.angular_velocity, entry.force, entry.magno,
+                          entry.time_delta);
+        const double error = angle_between(q, entry.truth);
+        if (i >= IMU_LOG_REST_SAMPLES && error > result.max_error) {
+            result.max_error = error;
+        }
+        result.final_error = error;
+    }
+
+    // Timing replays start over from the identity each pass
+    const bench_ticks_t start = Bench_Now();
+    for (size_t pass = 0; pass < BENCH_REPLAYS; pass++) {
+        q = Quaternion();
+        for (const replay_entry_t& entry : entries) {
+            q = filter.update(q, entry.angular_velocity, entry.force,
+                              entry.magno, entry.time_delta);
+        }
+    }
+    volatile double sink = q.w();
+    (void)sink;
+
+    char label[48];
+    snprintf(label, sizeof(label), "%s update", name);
+    result.cost = Bench_Report(label, Bench_Elapsed(start),
+                               BENCH_REPLAYS * entries.size());
+    printf("%-32s %10.2f deg final, %.2f deg max\n", name, result.final_error,
+           result.max_error);
+    return result;
+}
+
+void setUp(void) {
+    Bench_Init();
+    load_log();
+}
+
+void tearDown(void) {}
+
+/**
+ * The log starts at rest facing north, identity is the truth there
+ */
+void test_log_starts_at_identity(void) {
+    TEST_ASSERT_DOUBLE_WITHIN(0.1, 0, angle_between(Quaternion(),
+                                                    entries[0].truth));
+}
+
+void test_complementary_replay(void) {
+    ComplementaryFilter filter;
+    const replay_result_t result = replay(filter, "complementary");
+    TEST_ASSERT_TRUE(result.final_error < 5);
+}
+
+void test_madgwick_replay(void) {
+    MadgwickFilter filter;
+    const replay_result_t result = replay(filter, "madgwick");
+    TEST_ASSERT_TRUE(result.final_error < 5);
+}
+
+void test_mahony_replay(void) {
+    MahonyFilter filter;
+    const replay_result_t result = replay(filter, "mahony");
+    TEST_ASSERT_TRUE(result.final_error < 5);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_log_starts_at_identity);
+    RUN_TEST(test_complementary_replay);
+    RUN_TEST(test_madgwick_replay);
+    RUN_TEST(test_mahony_replay);
+    return UNITY_END();
+}
@@ -0,0 +1,146 @@
+/**
+ * Converting a FIFO batch through SampleBlock against the per-sample double
+ * conversion it replaced, and the INS update_batch it feeds. Run on the host
+ * with `pio test -e native` and on the board with `pio test -e disco_bench`.
+*/
+#include <math.h>
+#include <unity.h>
+
+#include <vector>
+
+#include "../bench.h"
+#include "driver/lsm6dsl.h"
+#include "math/conversion.h"
+#include "math/inertial_navigation.h"
+#include "math/sample_block.h"
+
+using namespace SimpleSlam;
+using namespace SimpleSlam::Math;
+
+#define BENCH_BATCHES (BENCH_ITERATIONS / FIFO_MAX_BATCH_SIZE + 1)
+
+static LSM6DSL::imu_sample_t samples[FIFO_MAX_BATCH_SIZE];
+static SampleBlock<FIFO_MAX_BATCH_SIZE> gyro_block;
+static SampleBlock<FIFO_MAX_BATCH_SIZE> accel_block;
+static uint32_t timestamps_us[FIFO_MAX_BATCH_SIZE];
+
+typedef struct {
+    Vector3 angular_velocity;
+    Vector3 force;
+    uint32_t timestamp_us;
+} reading_t;
+
+/** The per-sample conversion main.cpp used before SampleBlock */
+static void convert_per_sample(std::vector<reading_t>& readings) {
+    readings.clear();
+    for (size_t i = 0; i < FIFO_MAX_BATCH_SIZE; i++) {
+        const LSM6DSL::imu_sample_t& sample = samples[i];
+        const Vector3 gyro(sample.gyro[0], sample.gyro[1], sample.gyro[2]);
+        const Vector3 accel(sample.accel[0], sample.accel[1], sample.accel[2]);
+        readings.push_back(
+            {gyro * pi / 180000, accel / 1000, sample.timestamp_us});
+    }
+}
+
+static void convert_block() {
+    Load_Block(gyro_block, samples, &LSM6DSL::imu_sample_t::gyro,
+               FIFO_MAX_BATCH_SIZE);
+    Load_Block(accel_block, samples, &LSM6DSL::imu_sample_t::accel,
+               FIFO_MAX_BATCH_SIZE);
+    for (size_t i = 0; i < FIFO_MAX_BATCH_SIZE; i++) {
+        timestamps_us[i] = samples[i].timestamp_us;
+    }
+    Scale_Block(gyro_block, pi / 180000);
+    Scale_Block(accel_block, 1.0f / 1000);
+}
+
+void setUp() {
+    Bench_Init();
+    for (int i = 0; i < FIFO_MAX_BATCH_SIZE; i++) {
+        samples[i] = {
+            {(int16_t)(1750 * i), (int16_t)-900, INT16_MAX},
+            {(int16_t)(61 * i), INT16_MIN, (int16_t)1000},
+            (uint32_t)(4808 * i),
+        };
+    }
+}
+
+void tearDown() {}
+
+void test_block_matches_per_sample_conversion() {
+    std::vector<reading_t> readings;
+    convert_per_sample(readings);
+    convert_block();
+
+    TEST_ASSERT_EQUAL(FIFO_MAX_BATCH_SIZE, gyro_block.count);
+    for (size_t i = 0; i < FIFO_MAX_BATCH_SIZE; i++) {
+        const Vector3 gyro(gyro_block.x[i], gyro_block.y[i], gyro_block.z[i]);
+        const Vector3 accel(accel_block.x[i], accel_block.y[i],
+                            accel_block.z[i]);
+        for (int axis = 0; axis < 3; axis++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-6 * (1 + fabs(readings[i].angular_velocity[axis])),
+                                      readings[i].angular_velocity[axis], gyro[axis]);
+            TEST_ASSERT_DOUBLE_WITHIN(1e-6 * (1 + fabs(readings[i].force[axis])),
+                                      readings[i].force[axis], accel[axis]);
+        }
+        TEST_ASSERT_EQUAL(readings[i].timestamp_us, timestamps_us[i]);
+    }
+}
+
+/**
+ * A batch longer than the block is cut to its capacity
+ */
+void test_load_block_clamps_to_capacity() {
+    SampleBlock<4> block;
+    Load_Block(block, samples, &LSM6DSL::imu_sample_t::gyro,
+               FIFO_MAX_BATCH_SIZE);
+    TEST_ASSERT_EQUAL(4, block.count);
+    TEST_ASSERT_EQUAL(1750 * 3, (int)block.x[3]);
+    TEST_ASSERT_EQUAL(INT16_MAX, (int)block.z[3]);
+}
+
+void test_bench_batch_conversion() {
+    std::vector<reading_t> readings;
+    readings.reserve(FIFO_MAX_BATCH_SIZE);
+
+    bench_ticks_t start = Bench_Now();
+    for (uint32_t batch = 0; batch < BENCH_BATCHES; batch++) {
+        convert_per_sample(readings);
+    }
+    const double per_sample_cost = Bench_Report(
+        "per-sample Vector3 conversion", Bench_Elapsed(start),
+        BENCH_BATCHES * FIFO_MAX_BATCH_SIZE);
+
+    start = Bench_Now();
+    for (uint32_t batch = 0; batch < BENCH_BATCHES; batch++) {
+        convert_block();
+    }
+    const double block_cost =
+        Bench_Report("SampleBlock conversion", Bench_Elapsed(start),
+                     BENCH_BATCHES * FIFO_MAX_BATCH_SIZE);
+
+    InertialNavigationSystem ins(1 / 208.0, Vector3(1, 0, 0), Vector3(0, 0, 1),
+                                 Vector3(0, 0, 0), Vector3(0, 0, 0),
+                                 Vector3(0, 0, 0));
+    start = Bench_Now();
+    for (uint32_t batch = 0; batch < BENCH_BATCHES; batch++) {
+        convert_block();
+        ins.update_batch(gyro_block, accel_block, timestamps_us,
+                         Vector3(0.2, 0, -0.4));
+    }
+    Bench_Report("SampleBlock + INS update_batch", Bench_Elapsed(start),
+                 BENCH_BATCHES * FIFO_MAX_BATCH_SIZE);
+
+    volatile double sink = readings[0].force[0] + gyro_block.x[1] +
+                           ins.get_position()[0];
+    (void)sink;
+    TEST_ASSERT_TRUE(per_sample_cost > 0 && block_cost > 0);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_block_matches_per_sample_conversion);
+    RUN_TEST(test_load_block_clamps_to_capacity);
+    RUN_TEST(test_bench_batch_conversion);
+    return UNITY_END();
+}
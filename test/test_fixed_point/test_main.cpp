@@ -0,0 +1,163 @@
+/**
+ * FixedPoint against double: attitude integration in Q2.30, the saturating
+ * edges of sqrt and normalize, and sensor counts through from_ratio.
+*/
+#include <math.h>
+#include <unity.h>
+
+#include "math/fixed_point.h"
+#include "math/orientation_filter.h"
+
+using namespace SimpleSlam::Math;
+
+#define Q16_LSB (1.0 / (1 << 16))
+#define Q30_LSB (1.0 / (1 << 30))
+
+static Quaternion to_double(const Quaternionq& q) {
+    return Quaternion(q);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+/**
+ * Ten seconds at 208Hz of a tumbling rotation, the same integration step
+ * run in Q2.30 and double
+ */
+void test_q2_30_gyro_integration_tracks_double() {
+    const double time_delta = 1 / 208.0;
+    Quaternion q;
+    Quaternionq q_fixed;
+    double max_error = 0;
+    for (int i = 0; i < 2080; i++) {
+        const double t = i * time_delta;
+        const Vector3 rate(1.5 * sin(t), 0.8 * cos(0.7 * t), -1.2);
+        q = Integrate_Gyro(q, rate, time_delta);
+        q_fixed = Integrate_Gyro(q_fixed, UnitVector3q(rate), q2_30_t(time_delta));
+
+        const Quaternion q_back = to_double(q_fixed);
+        max_error = fmax(max_error, fabs(q_back.x() - q.x()));
+        max_error = fmax(max_error, fabs(q_back.y() - q.y()));
+        max_error = fmax(max_error, fabs(q_back.z() - q.z()));
+        max_error = fmax(max_error, fabs(q_back.w() - q.w()));
+    }
+    printf("Q2.30 vs double after 2080 steps: %.3g max component error\n", max_error);
+    TEST_ASSERT_TRUE(max_error < 1e-6);
+    TEST_ASSERT_DOUBLE_WITHIN(1e-8, 1, (double)q_fixed.norm_squared());
+
+    // A vector rotated by either ends up in the same place
+    const Vector3 v(0.6, -0.3, 0.74);
+    const Vector3 rotated = q.rotate(v);
+    const Vector3 rotated_fixed(q_fixed.rotate(UnitVector3q(v)));
+    for (int axis = 0; axis < 3; axis++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, rotated[axis], rotated_fixed[axis]);
+    }
+}
+
+void test_sqrt_edges() {
+    // Negative and zero give zero rather than wrapping
+    TEST_ASSERT_EQUAL(0, sqrt(q2_30_t(-0.5)).raw());
+    TEST_ASSERT_EQUAL(0, sqrt(q2_30_t::from_raw(INT32_MIN)).raw());
+    TEST_ASSERT_EQUAL(0, sqrt(q2_30_t()).raw());
+
+    // Smallest positive value, sqrt(2^-30) = 2^-15
+    TEST_ASSERT_EQUAL(1 << 15, sqrt(q2_30_t::from_raw(1)).raw());
+    TEST_ASSERT_EQUAL(1 << 8, sqrt(q16_16_t::from_raw(1)).raw());
+
+    // Largest values, the intermediate needs all 64 bits
+    TEST_ASSERT_DOUBLE_WITHIN(Q30_LSB, sqrt(INT32_MAX * Q30_LSB),
+                              (double)sqrt(q2_30_t::from_raw(INT32_MAX)));
+    TEST_ASSERT_DOUBLE_WITHIN(Q16_LSB, sqrt(INT32_MAX * Q16_LSB),
+                              (double)sqrt(q16_16_t::from_raw(INT32_MAX)));
+
+    // Within a bit of the true root across the Q2.30 range
+    for (int32_t raw = 1; raw > 0 && raw < INT32_MAX - 9999991; raw += 9999991) {
+        const double expected = sqrt(raw * Q30_LSB);
+        TEST_ASSERT_DOUBLE_WITHIN(Q30_LSB, expected,
+                                  (double)sqrt(q2_30_t::from_raw(raw)));
+    }
+}
+
+void test_saturating_arithmetic_edges() {
+    const q2_30_t max = q2_30_t::from_raw(INT32_MAX);
+    const q2_30_t min = q2_30_t::from_raw(INT32_MIN);
+    const q2_30_t lsb = q2_30_t::from_raw(1);
+
+    TEST_ASSERT_EQUAL(INT32_MAX, (max + lsb).raw());
+    TEST_ASSERT_EQUAL(INT32_MIN, (min - lsb).raw());
+    TEST_ASSERT_EQUAL(INT32_MAX, (-min).raw());
+    TEST_ASSERT_EQUAL(INT32_MAX, (q2_30_t(1.5) * q2_30_t(1.5)).raw());
+    TEST_ASSERT_EQUAL(INT32_MIN, (q2_30_t(1.5) * q2_30_t(-1.5)).raw());
+    TEST_ASSERT_EQUAL(INT32_MAX, (q2_30_t(1) / q2_30_t()).raw());
+    TEST_ASSERT_EQUAL(INT32_MIN, (q2_30_t(-1) / q2_30_t()).raw());
+
+    // Out of range doubles clip
+    TEST_ASSERT_EQUAL(INT32_MAX, q2_30_t(2.0).raw());
+    TEST_ASSERT_EQUAL(INT32_MIN, q2_30_t(-2.0).raw());
+}
+
+void test_normalize_edges() {
+    // Drifted just inside the fast path, and just outside it
+    const double scales[] = {1 + 1e-4, 1 - 1e-4, 1.3, 0.5};
+    for (double scale : scales) {
+        const Quaternion q = Quaternion(0.3, -0.5, 0.1, 0.8).normalize() * scale;
+        const Quaternionq n = Quaternionq(q).normalize();
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, 1, (double)n.norm_squared());
+        const Quaternion expected = q.normalize();
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, expected.x(), (double)n.x());
+        TEST_ASSERT_DOUBLE_WITHIN(1e-6, expected.w(), (double)n.w());
+    }
+
+    // Largest norm Q2.30 can hold, |q|^2 just under 2
+    const Quaternionq wide(q2_30_t(0.7), q2_30_t(0.7), q2_30_t(0.7), q2_30_t(0.7));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 1, (double)wide.normalize().norm_squared());
+
+    // Q2.30 vectors normalize up to |v|^2 just under 2
+    const UnitVector3q v = UnitVector3q(Vector3(1.0, -0.9, 0.3)).normalize();
+    TEST_ASSERT_DOUBLE_WITHIN(1e-6, 1, (double)v.dot(v));
+
+    // Past that the dot product clips, so longer vectors are normalized in
+    // Q16.16 before narrowing
+    const Vector3 wide_vector(1.2, -0.9, 0.3);
+    TEST_ASSERT_EQUAL(INT32_MAX, UnitVector3q(wide_vector).dot(UnitVector3q(wide_vector)).raw());
+    const UnitVector3q narrowed(Vector3q(wide_vector).normalize());
+    TEST_ASSERT_DOUBLE_WITHIN(1e-4, 1, (double)narrowed.dot(narrowed));
+}
+
+void test_from_ratio_int16_extremes() {
+    // Accel mg to g, every int16 within a bit of the double result
+    for (int32_t count = INT16_MIN; count <= INT16_MAX; count++) {
+        const double expected = count / 1000.0;
+        const double actual = (double)q16_16_t::from_ratio(count, 1000);
+        if (fabs(expected - actual) > Q16_LSB) {
+            TEST_ASSERT_DOUBLE_WITHIN(Q16_LSB, expected, actual);
+        }
+    }
+
+    // Whole counts fit Q16.16 exactly at both ends
+    TEST_ASSERT_EQUAL(INT16_MIN * 65536, q16_16_t::from_ratio(INT16_MIN, 1).raw());
+    TEST_ASSERT_EQUAL(INT16_MAX * 65536, q16_16_t::from_ratio(INT16_MAX, 1).raw());
+    // Negating the most negative count overflows and clips
+    TEST_ASSERT_EQUAL(INT32_MAX, q16_16_t::from_ratio(INT16_MIN, -1).raw());
+    // Divide by zero clips towards the numerator's sign
+    TEST_ASSERT_EQUAL(INT32_MAX, q16_16_t::from_ratio(INT16_MAX, 0).raw());
+    TEST_ASSERT_EQUAL(INT32_MIN, q16_16_t::from_ratio(INT16_MIN, 0).raw());
+
+    // The buffer helper matches from_ratio axis by axis
+    const int16_t raw[3] = {INT16_MIN, 0, INT16_MAX};
+    const Vector3q v = To_Fixed_Vector(raw, 1000);
+    TEST_ASSERT_EQUAL(q16_16_t::from_ratio(INT16_MIN, 1000).raw(), v[0].raw());
+    TEST_ASSERT_EQUAL(0, v[1].raw());
+    TEST_ASSERT_EQUAL(q16_16_t::from_ratio(INT16_MAX, 1000).raw(), v[2].raw());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_q2_30_gyro_integration_tracks_double);
+    RUN_TEST(test_sqrt_edges);
+    RUN_TEST(test_saturating_arithmetic_edges);
+    RUN_TEST(test_normalize_edges);
+    RUN_TEST(test_from_ratio_int16_extremes);
+    return UNITY_END();
+}
@@ -0,0 +1,423 @@
+/**
+ * Ordering and completion of the async I2C engine against the mock HAL, and
+ * the LSM6DSL FIFO drain chained on top of it.
+*/
+#include <unity.h>
+
+#include <vector>
+
+#include "driver/i2c.h"
+#include "driver/i2c_async.h"
+#include "driver/lsm6dsl.h"
+
+using namespace SimpleSlam;
+
+// Blocking side of the bus, only the FIFO status and config go through it
+static uint32_t transaction_count = 0;
+
+I2C_HandleTypeDef* SimpleSlam::I2C_Get_Handle() { return &Mock_HAL::i2c_handle; }
+uint32_t SimpleSlam::I2C_Get_Transaction_Count() { return transaction_count; }
+void SimpleSlam::I2C_Count_Transaction() { transaction_count++; }
+void SimpleSlam::I2C_Init() {}
+void SimpleSlam::I2C_DeInit() {}
+HAL_StatusTypeDef SimpleSlam::I2C_Mem_Read(uint16_t, uint16_t, uint16_t, uint8_t*, uint16_t) {
+    return HAL_OK;
+}
+HAL_StatusTypeDef SimpleSlam::I2C_Mem_Write_Single(uint16_t, uint16_t, uint8_t) {
+    return HAL_OK;
+}
+HAL_StatusTypeDef SimpleSlam::I2C_Mem_Read_Single(uint16_t, uint16_t, uint8_t*) {
+    return HAL_OK;
+}
+
+static std::vector<uint16_t> completed;
+static uint8_t buffers[I2C_ASYNC_QUEUE_SIZE + 2][4];
+
+static void record_completion(i2c_transaction_t* transaction) {
+    completed.push_back(transaction->reg_address);
+}
+
+static i2c_transaction_t make_read(uint16_t reg_address, uint8_t* buffer) {
+    return i2c_transaction_t{
+        .type = I2CTransactionType::READ,
+        .peripheral_address = 0x3C,
+        .reg_address = reg_address,
+        .reg_address_size = I2C_MEMADD_SIZE_8BIT,
+        .buffer = buffer,
+        .size = 4,
+        .on_complete = record_completion,
+        .flags = nullptr,
+        .flag_mask = 0,
+    };
+}
+
+void setUp() {
+    Mock_HAL::Reset();
+    completed.clear();
+    transaction_count = 0;
+    I2C_Async_Init();
+}
+
+void tearDown() {
+    I2C_Async_DeInit();
+}
+
+void test_submit_starts_transfer_when_idle() {
+    EventFlags flags;
+    i2c_transaction_t transaction = make_read(0x28, buffers[0]);
+    transaction.flags = &flags;
+    transaction.flag_mask = 0x04;
+
+    TEST_ASSERT_EQUAL(HAL_OK, I2C_Async_Submit(&transaction));
+    TEST_ASSERT_EQUAL(1, Mock_HAL::transfers.size());
+    TEST_ASSERT_TRUE(Mock_HAL::transfers[0].is_read);
+    TEST_ASSERT_EQUAL(0x3C, Mock_HAL::transfers[0].peripheral_address);
+    TEST_ASSERT_EQUAL(0x28, Mock_HAL::transfers[0].reg_address);
+    TEST_ASSERT_EQUAL(4, Mock_HAL::transfers[0].size);
+    TEST_ASSERT_FALSE(transaction.done);
+    TEST_ASSERT_FALSE(I2C_Async_Is_Idle());
+    TEST_ASSERT_EQUAL(1, transaction_count);
+
+    const uint8_t data[4] = {1, 2, 3, 4};
+    Mock_HAL::Complete_Transfer(data);
+    TEST_ASSERT_TRUE(transaction.done);
+    TEST_ASSERT_EQUAL(HAL_OK, transaction.status);
+    TEST_ASSERT_EQUAL_MEMORY(data, buffers[0], 4);
+    TEST_ASSERT_EQUAL(0x04, flags.get());
+    TEST_ASSERT_EQUAL(1, completed.size());
+    TEST_ASSERT_TRUE(I2C_Async_Is_Idle());
+}
+
+void test_queued_transactions_run_in_order() {
+    i2c_transaction_t first = make_read(0x10, buffers[0]);
+    i2c_transaction_t second = make_read(0x20, buffers[1]);
+    i2c_transaction_t third = make_read(0x30, buffers[2]);
+    I2C_Async_Submit(&first);
+    I2C_Async_Submit(&second);
+    I2C_Async_Submit(&third);
+
+    // Only one transfer may own the bus at a time
+    TEST_ASSERT_EQUAL(1, Mock_HAL::transfers.size());
+
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_EQUAL(2, Mock_HAL::transfers.size());
+    TEST_ASSERT_EQUAL(0x20, Mock_HAL::transfers[1].reg_address);
+    TEST_ASSERT_FALSE(second.done);
+
+    Mock_HAL::Complete_Transfer();
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_EQUAL(3, completed.size());
+    TEST_ASSERT_EQUAL(0x10, completed[0]);
+    TEST_ASSERT_EQUAL(0x20, completed[1]);
+    TEST_ASSERT_EQUAL(0x30, completed[2]);
+    TEST_ASSERT_TRUE(I2C_Async_Is_Idle());
+}
+
+static i2c_transaction_t chained;
+
+static void submit_chained(i2c_transaction_t* transaction) {
+    record_completion(transaction);
+    I2C_Async_Submit(&chained);
+}
+
+void test_completion_can_chain_a_transaction_behind_the_queue() {
+    i2c_transaction_t first = make_read(0x10, buffers[0]);
+    i2c_transaction_t queued = make_read(0x20, buffers[1]);
+    chained = make_read(0x40, buffers[2]);
+    first.on_complete = submit_chained;
+    I2C_Async_Submit(&first);
+    I2C_Async_Submit(&queued);
+
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_EQUAL(0x20, Mock_HAL::transfers.back().reg_address);
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_EQUAL(0x40, Mock_HAL::transfers.back().reg_address);
+    Mock_HAL::Complete_Transfer();
+
+    TEST_ASSERT_EQUAL(3, completed.size());
+    TEST_ASSERT_EQUAL(0x40, completed[2]);
+    TEST_ASSERT_TRUE(chained.done);
+}
+
+void test_failed_start_completes_with_error_and_moves_on() {
+    i2c_transaction_t first = make_read(0x10, buffers[0]);
+    i2c_transaction_t second = make_read(0x20, buffers[1]);
+
+    Mock_HAL::next_start_status = HAL_ERROR;
+    TEST_ASSERT_EQUAL(HAL_OK, I2C_Async_Submit(&first));
+    TEST_ASSERT_TRUE(first.done);
+    TEST_ASSERT_EQUAL(HAL_ERROR, first.status);
+    TEST_ASSERT_TRUE(I2C_Async_Is_Idle());
+
+    I2C_Async_Submit(&second);
+    TEST_ASSERT_EQUAL(1, Mock_HAL::transfers.size());
+    TEST_ASSERT_EQUAL(0x20, Mock_HAL::transfers[0].reg_address);
+
+    // Finish before second goes out of scope
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_TRUE(second.done);
+    TEST_ASSERT_EQUAL(HAL_OK, second.status);
+}
+
+void test_bus_error_fails_active_transaction_and_starts_next() {
+    i2c_transaction_t first = make_read(0x10, buffers[0]);
+    i2c_transaction_t second = make_read(0x20, buffers[1]);
+    I2C_Async_Submit(&first);
+    I2C_Async_Submit(&second);
+
+    Mock_HAL::Fail_Transfer();
+    TEST_ASSERT_TRUE(first.done);
+    TEST_ASSERT_EQUAL(HAL_ERROR, first.status);
+    TEST_ASSERT_EQUAL(2, Mock_HAL::transfers.size());
+    TEST_ASSERT_FALSE(second.done);
+
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_EQUAL(HAL_OK, second.status);
+}
+
+void test_full_queue_returns_busy() {
+    i2c_transaction_t transactions[I2C_ASYNC_QUEUE_SIZE + 2];
+    // The first goes straight to the bus, the queue holds the rest
+    for (size_t i = 0; i < I2C_ASYNC_QUEUE_SIZE + 1; i++) {
+        transactions[i] = make_read(i, buffers[i]);
+        TEST_ASSERT_EQUAL(HAL_OK, I2C_Async_Submit(&transactions[i]));
+    }
+    transactions[I2C_ASYNC_QUEUE_SIZE + 1] = make_read(0xFF, buffers[0]);
+    TEST_ASSERT_EQUAL(HAL_BUSY, I2C_Async_Submit(&transactions[I2C_ASYNC_QUEUE_SIZE + 1]));
+
+    // Fail the rest while they are still in scope
+    I2C_Async_DeInit();
+}
+
+void test_deinit_fails_everything_outstanding() {
+    i2c_transaction_t first = make_read(0x10, buffers[0]);
+    i2c_transaction_t second = make_read(0x20, buffers[1]);
+    I2C_Async_Submit(&first);
+    I2C_Async_Submit(&second);
+
+    I2C_Async_DeInit();
+    TEST_ASSERT_EQUAL(HAL_ERROR, first.status);
+    TEST_ASSERT_EQUAL(HAL_ERROR, second.status);
+    TEST_ASSERT_EQUAL(2, completed.size());
+    TEST_ASSERT_TRUE(I2C_Async_Is_Idle());
+
+    i2c_transaction_t late = make_read(0x30, buffers[2]);
+    TEST_ASSERT_EQUAL(HAL_ERROR, I2C_Async_Submit(&late));
+}
+
+void test_wait_polls_until_done_or_timeout() {
+    i2c_transaction_t transaction = make_read(0x10, buffers[0]);
+    I2C_Async_Submit(&transaction);
+    TEST_ASSERT_EQUAL(HAL_TIMEOUT, I2C_Async_Wait(&transaction, 5));
+
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_EQUAL(HAL_OK, I2C_Async_Wait(&transaction, 5));
+}
+
+static int batches_ready = 0;
+
+static void count_batch() {
+    batches_ready++;
+}
+
+static void init_fifo() {
+    LSM6DSL::fifo_config_t config{
+        .odr = FIFO_ODR_208HZ,
+        .decimation = FIFO_DEC_NONE,
+        .threshold = 5,
+    };
+    TEST_ASSERT_FALSE(LSM6DSL::FIFO_Init(config).has_value());
+    batches_ready = 0;
+}
+
+void test_fifo_drain_chains_burst_behind_queued_reads() {
+    init_fifo();
+    TEST_ASSERT_EQUAL(HAL_OK, LSM6DSL::FIFO_Submit_Read_Batch(count_batch));
+    TEST_ASSERT_EQUAL(FIFO_STATUS_1_REG, Mock_HAL::transfers[0].reg_address);
+    TEST_ASSERT_EQUAL(FIFO_STATUS_SIZE, Mock_HAL::transfers[0].size);
+
+    // Another sensor's read lands while the status is on the wire
+    i2c_transaction_t magnetometer = make_read(0x28, buffers[0]);
+    I2C_Async_Submit(&magnetometer);
+
+    // Two samples unread, pattern at gyro X
+    const uint8_t fifo_status[FIFO_STATUS_SIZE] = {12, 0, 0, 0};
+    Mock_HAL::Complete_Transfer(fifo_status);
+    TEST_ASSERT_EQUAL(0x28, Mock_HAL::transfers[1].reg_address);
+    Mock_HAL::Complete_Transfer();
+    TEST_ASSERT_EQUAL(FIFO_DATA_OUT_L_REG, Mock_HAL::transfers[2].reg_address);
+    TEST_ASSERT_EQUAL(2 * FIFO_WORDS_PER_SAMPLE * 2, Mock_HAL::transfers[2].size);
+    TEST_ASSERT_EQUAL(0, batches_ready);
+
+    // A second drain must wait until this batch has been collected
+    TEST_ASSERT_EQUAL(HAL_BUSY, LSM6DSL::FIFO_Submit_Read_Batch(count_batch));
+
+    const int16_t words[2 * FIFO_WORDS_PER_SAMPLE] = {
+        100, 0, -100, 1000, 0, -1000,
+        200, 0, -200, 2000, 0, -2000,
+    };
+    Mock_HAL::us_ticks = 100000;
+    Mock_HAL::Complete_Transfer((const uint8_t*)words);
+    TEST_ASSERT_EQUAL(1, batches_ready);
+
+    LSM6DSL::imu_sample_t samples[FIFO_MAX_BATCH_SIZE];
+    size_t num_samples = 0;
+    TEST_ASSERT_FALSE(LSM6DSL::FIFO_Get_Batch(samples, num_samples).has_value());
+    TEST_ASSERT_EQUAL(2, num_samples);
+    TEST_ASSERT_EQUAL(1750, samples[0].gyro[0]);
+    TEST_ASSERT_EQUAL(-1750, samples[0].gyro[2]);
+    TEST_ASSERT_EQUAL(61, samples[0].accel[0]);
+    TEST_ASSERT_EQUAL(-122, samples[1].accel[2]);
+    TEST_ASSERT_EQUAL(LSM6DSL::FIFO_Get_Sample_Period_Us(),
+                      samples[1].timestamp_us - samples[0].timestamp_us);
+
+    // Collected, so there is nothing left and the next drain may start
+    TEST_ASSERT_TRUE(LSM6DSL::FIFO_Get_Batch(samples, num_samples).has_value());
+    TEST_ASSERT_EQUAL(HAL_OK, LSM6DSL::FIFO_Submit_Read_Batch(count_batch));
+    const uint8_t empty_status[FIFO_STATUS_SIZE] = {0, 0, 0, 0};
+    Mock_HAL::Complete_Transfer(empty_status);
+    LSM6DSL::FIFO_Get_Batch(samples, num_samples);
+}
+
+void test_fifo_drain_with_nothing_unread_skips_burst() {
+    init_fifo();
+    LSM6DSL::FIFO_Submit_Read_Batch(count_batch);
+    const uint8_t fifo_status[FIFO_STATUS_SIZE] = {4, 0, 2, 0};
+    Mock_HAL::Complete_Transfer(fifo_status);
+
+    TEST_ASSERT_EQUAL(1, Mock_HAL::transfers.size());
+    TEST_ASSERT_EQUAL(1, batches_ready);
+    LSM6DSL::imu_sample_t samples[FIFO_MAX_BATCH_SIZE];
+    size_t num_samples = 1;
+    TEST_ASSERT_FALSE(LSM6DSL::FIFO_Get_Batch(samples, num_samples).has_value());
+    TEST_ASSERT_EQUAL(0, num_samples);
+}
+
+void test_fifo_drain_reports_bus_error() {
+    init_fifo();
+    LSM6DSL::FIFO_Submit_Read_Batch(count_batch);
+    Mock_HAL::Fail_Transfer();
+
+    TEST_ASSERT_EQUAL(1, batches_ready);
+    LSM6DSL::imu_sample_t samples[FIFO_MAX_BATCH_SIZE];
+    size_t num_samples = 0;
+    auto maybe_error = LSM6DSL::FIFO_Get_Batch(samples, num_samples);
+    TEST_ASSERT_TRUE(maybe_error.has_value());
+    TEST_ASSERT_EQUAL((int)LSM6DSL::ErrorCode::I2C_ERROR, (int)maybe_error->first);
+    TEST_ASSERT_EQUAL(0, num_samples);
+}
+
+/**
+ * One async drain of whole samples, the status read finishing at
+ * status_time_us
+*/
+static size_t drain_fifo(uint16_t unread_samples, uint32_t status_time_us,
+                         LSM6DSL::imu_sample_t* samples) {
+    static int16_t words[FIFO_MAX_BATCH_SIZE * FIFO_WORDS_PER_SAMPLE];
+    const uint16_t unread_words = unread_samples * FIFO_WORDS_PER_SAMPLE;
+    const uint8_t fifo_status[FIFO_STATUS_SIZE] = {
+        (uint8_t)unread_words, (uint8_t)(unread_words >> 8), 0, 0};
+
+    LSM6DSL::FIFO_Submit_Read_Batch(count_batch);
+    Mock_HAL::us_ticks = status_time_us;
+    Mock_HAL::Complete_Transfer(fifo_status);
+    if (unread_samples > 0) {
+        Mock_HAL::us_ticks = status_time_us + 700;
+        Mock_HAL::Complete_Transfer((const uint8_t*)words);
+    }
+
+    size_t num_samples = 0;
+    TEST_ASSERT_FALSE(LSM6DSL::FIFO_Get_Batch(samples, num_samples).has_value());
+    return num_samples;
+}
+
+/**
+ * Simulates the sensor producing a sample every period_us and drains it at
+ * irregular times, returning the sample timestamps in order
+*/
+static std::vector<uint32_t> drain_stream(double period_us, int num_drains) {
+    std::vector<uint32_t> timestamps;
+    LSM6DSL::imu_sample_t samples[FIFO_MAX_BATCH_SIZE];
+    uint32_t produced = 0;
+    uint32_t drained = 0;
+    // Fixed pseudo random latencies, 0 to 3ms after the watermark
+    uint32_t seed = 12345;
+    for (int drain = 0; drain < num_drains; drain++) {
+        seed = seed * 1103515245 + 12345;
+        const uint32_t latency_us = (seed >> 16) % 3000;
+        const uint32_t status_time_us =
+            1000000 + (uint32_t)((drained + 5) * period_us) + latency_us;
+        while ((produced + 1) * period_us <= status_time_us - 1000000) {
+            produced++;
+        }
+        // Sample n is taken at 1000000 + n * period_us
+        const size_t num_samples =
+            drain_fifo(produced - drained + 1, status_time_us, samples);
+        for (size_t i = 0; i < num_samples; i++) {
+            timestamps.push_back(samples[i].timestamp_us);
+        }
+        drained += num_samples;
+    }
+    return timestamps;
+}
+
+void test_fifo_timestamps_spread_drain_latency() {
+    init_fifo();
+    const uint32_t period_us = LSM6DSL::FIFO_Get_Sample_Period_Us();
+    const std::vector<uint32_t> timestamps = drain_stream(period_us, 200);
+
+    // Up to 3ms of latency per drain would show up whole on the first step
+    // of each batch if the batch was back-dated from its own read time
+    for (size_t i = 100; i < timestamps.size(); i++) {
+        const uint32_t step_us = timestamps[i] - timestamps[i - 1];
+        TEST_ASSERT_TRUE(step_us > period_us * 9 / 10);
+        TEST_ASSERT_TRUE(step_us < period_us * 11 / 10);
+    }
+}
+
+void test_fifo_timestamps_follow_a_slow_sensor_clock() {
+    init_fifo();
+    const uint32_t period_us = LSM6DSL::FIFO_Get_Sample_Period_Us();
+    // Sensor oscillator running 2% slow
+    const double true_period_us = period_us * 1.02;
+    const std::vector<uint32_t> timestamps = drain_stream(true_period_us, 400);
+
+    const size_t last = timestamps.size() - 1;
+    const double mean_step_us =
+        (double)(timestamps[last] - timestamps[last - 200]) / 200;
+    TEST_ASSERT_TRUE(mean_step_us > true_period_us - 10);
+    TEST_ASSERT_TRUE(mean_step_us < true_period_us + 10);
+}
+
+void test_fifo_timestamps_restart_after_overrun() {
+    init_fifo();
+    const uint32_t period_us = LSM6DSL::FIFO_Get_Sample_Period_Us();
+    LSM6DSL::imu_sample_t samples[FIFO_MAX_BATCH_SIZE];
+    drain_fifo(5, 1000000, samples);
+
+    // A second later the FIFO has wrapped and only holds its newest samples,
+    // the stream count is off by far more than a period
+    const size_t num_samples = drain_fifo(5, 2000000, samples);
+    TEST_ASSERT_EQUAL(5, num_samples);
+    TEST_ASSERT_EQUAL(2000000, samples[4].timestamp_us);
+    TEST_ASSERT_EQUAL(period_us, samples[4].timestamp_us - samples[3].timestamp_us);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_submit_starts_transfer_when_idle);
+    RUN_TEST(test_queued_transactions_run_in_order);
+    RUN_TEST(test_completion_can_chain_a_transaction_behind_the_queue);
+    RUN_TEST(test_failed_start_completes_with_error_and_moves_on);
+    RUN_TEST(test_bus_error_fails_active_transaction_and_starts_next);
+    RUN_TEST(test_full_queue_returns_busy);
+    RUN_TEST(test_deinit_fails_everything_outstanding);
+    RUN_TEST(test_wait_polls_until_done_or_timeout);
+    RUN_TEST(test_fifo_drain_chains_burst_behind_queued_reads);
+    RUN_TEST(test_fifo_drain_with_nothing_unread_skips_burst);
+    RUN_TEST(test_fifo_drain_reports_bus_error);
+    RUN_TEST(test_fifo_timestamps_spread_drain_latency);
+    RUN_TEST(test_fifo_timestamps_follow_a_slow_sensor_clock);
+    RUN_TEST(test_fifo_timestamps_restart_after_overrun);
+    return UNITY_END();
+}
@@ -0,0 +1,122 @@
+/**
+ * I2C_TIMING_TABLE against the RM0351 timing formulas. Each TIMINGR is decoded
+ * and the resulting bus timing checked independently of how it was computed.
+*/
+#include <stdio.h>
+#include <unity.h>
+
+#include "driver/i2c_timing.h"
+
+using namespace SimpleSlam;
+
+typedef struct {
+    uint32_t presc;
+    uint32_t scldel;
+    uint32_t sdadel;
+    uint32_t sclh;
+    uint32_t scll;
+} timingr_fields_t;
+
+static timingr_fields_t decode(uint32_t timingr) {
+    return {
+        timingr >> 28,
+        (timingr >> 20) & 0x0F,
+        (timingr >> 16) & 0x0F,
+        (timingr >> 8) & 0xFF,
+        timingr & 0xFF,
+    };
+}
+
+static double clock_ns(uint32_t clock_hz) {
+    return 1e9 / clock_hz;
+}
+
+static double presc_ns(const i2c_timing_entry_t& entry) {
+    return (decode(entry.timingr).presc + 1) * clock_ns(entry.clock_hz);
+}
+
+/**
+ * RM0351 39.4.9: tSCL = tSYNC1 + tSYNC2 + (SCLL + 1 + SCLH + 1) * tPRESC.
+ * Each tSYNC is the analog filter delay plus 2 to 3 kernel clocks, the SCL
+ * slopes are left out as they only slow the bus further.
+*/
+static double scl_rate_hz(const i2c_timing_entry_t& entry, int sync_clocks) {
+    const timingr_fields_t fields = decode(entry.timingr);
+    const double sync_ns = I2C_ANALOG_FILTER_MIN_NS + sync_clocks * clock_ns(entry.clock_hz);
+    const double period_ns = 2 * sync_ns + (fields.scll + 1 + fields.sclh + 1) * presc_ns(entry);
+    return 1e9 / period_ns;
+}
+
+static const i2c_timing_entry_t* find(uint32_t clock_hz, I2CSpeed speed) {
+    for (const auto& entry : I2C_TIMING_TABLE) {
+        if (entry.clock_hz == clock_hz && entry.speed == speed) {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_known_timings() {
+    const i2c_timing_entry_t* entry = find(80000000, I2CSpeed::FAST_400KHZ);
+    TEST_ASSERT_NOT_NULL(entry);
+    TEST_ASSERT_EQUAL_HEX32(0x10F91D3F, entry->timingr);
+    TEST_ASSERT_EQUAL_HEX32(0x10F91D3F, I2C_Compute_Timing(80000000, I2CSpeed::FAST_400KHZ));
+
+    // Fast-mode Plus needs the kernel clock above 16MHz
+    TEST_ASSERT_EQUAL_HEX32(0, I2C_Compute_Timing(16000000, I2CSpeed::FAST_PLUS_1MHZ));
+}
+
+void test_rate_does_not_exceed_requested() {
+    for (const auto& entry : I2C_TIMING_TABLE) {
+        const double requested_hz = I2C_Bus_Spec(entry.speed).frequency_hz;
+        const double rate_hz = scl_rate_hz(entry, 3);
+        char message[64];
+        snprintf(message, sizeof(message), "%u Hz kernel clock, %.0f Hz bus",
+                 (unsigned)entry.clock_hz, requested_hz);
+        TEST_ASSERT_TRUE_MESSAGE(rate_hz <= requested_hz, message);
+        // Kernel clock granularity aside, the rate should not give much away
+        TEST_ASSERT_TRUE_MESSAGE(rate_hz >= 0.9 * requested_hz, message);
+    }
+}
+
+void test_low_and_high_periods_meet_bus_minimums() {
+    for (const auto& entry : I2C_TIMING_TABLE) {
+        const i2c_bus_spec_t spec = I2C_Bus_Spec(entry.speed);
+        const timingr_fields_t fields = decode(entry.timingr);
+        // Shortest synchronization, 2 kernel clocks
+        const double sync_ns = I2C_ANALOG_FILTER_MIN_NS + 2 * clock_ns(entry.clock_hz);
+        TEST_ASSERT_TRUE((fields.scll + 1) * presc_ns(entry) + sync_ns >= spec.low_min_ns);
+        TEST_ASSERT_TRUE((fields.sclh + 1) * presc_ns(entry) + sync_ns >= spec.high_min_ns);
+    }
+}
+
+/**
+ * RM0351 39.4.5 data hold and setup time constraints
+*/
+void test_data_hold_and_setup_times() {
+    for (const auto& entry : I2C_TIMING_TABLE) {
+        const i2c_bus_spec_t spec = I2C_Bus_Spec(entry.speed);
+        const timingr_fields_t fields = decode(entry.timingr);
+        const double sdadel_ns = fields.sdadel * presc_ns(entry);
+        const double scldel_ns = (fields.scldel + 1) * presc_ns(entry);
+        const double i2c_clock_ns = clock_ns(entry.clock_hz);
+
+        TEST_ASSERT_TRUE(sdadel_ns >= (double)spec.fall_ns + spec.hold_min_ns -
+                                          I2C_ANALOG_FILTER_MIN_NS - 3 * i2c_clock_ns);
+        TEST_ASSERT_TRUE(sdadel_ns <= (double)spec.valid_max_ns - spec.rise_ns -
+                                          I2C_ANALOG_FILTER_MAX_NS - 4 * i2c_clock_ns);
+        TEST_ASSERT_TRUE(scldel_ns >= spec.rise_ns + spec.setup_min_ns);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_known_timings);
+    RUN_TEST(test_rate_does_not_exceed_requested);
+    RUN_TEST(test_low_and_high_periods_meet_bus_minimums);
+    RUN_TEST(test_data_hold_and_setup_times);
+    return UNITY_END();
+}
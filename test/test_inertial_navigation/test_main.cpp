@@ -0,0 +1,160 @@
+/**
+ * Starting alignment, the error-state filter seeded from it and its bias
+ * estimates under ZUPT
+*/
+#include <math.h>
+#include <unity.h>
+
+#include "math/error_state_kalman_filter.h"
+#include "math/inertial_navigation.h"
+
+using namespace SimpleSlam::Math;
+
+#define TIME_DELTA (1 / 208.0)
+
+// Board tilted about x and y, field pointing north-east and down
+static const Quaternion BOARD = (Quaternion(0.1, -0.15, 0.35, 1)).normalize();
+static const Vector3 EARTH_FIELD(0.2, 0, -0.4);
+// 2% scale error on the accel
+static const double ACCEL_SCALE = 1.02;
+// Biases the filter has to find, rad/s and m/s^2
+static const Vector3 GYRO_BIAS(0.01, -0.02, 0.015);
+static const Vector3 ACCEL_BIAS(0.15, -0.1, 0.2);
+
+static InertialNavigationSystem make_ins(const Vector3& accel_offset) {
+    return InertialNavigationSystem(TIME_DELTA, Vector3(1, 0, 0), accel_offset,
+                                    Vector3(0, 0, 0), Vector3(0, 0, 0),
+                                    Vector3(0, 0, 0));
+}
+
+static void assert_vector_within(double delta, const Vector3& expected,
+                                 const Vector3& actual) {
+    for (int axis = 0; axis < 3; axis++) {
+        TEST_ASSERT_DOUBLE_WITHIN(delta, expected[axis], actual[axis]);
+    }
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_align_recovers_orientation(void) {
+    const Vector3 force = BOARD.rotate_inverse(Vector3(0, 0, ACCEL_SCALE));
+    const Vector3 magno = BOARD.rotate_inverse(EARTH_FIELD);
+
+    InertialNavigationSystem ins = make_ins(force);
+    ins.align(force, magno);
+
+    const Quaternion q = ins.get_orientation();
+    assert_vector_within(1e-9, Vector3(0, 0, 1), q.rotate(force.normalize()));
+    assert_vector_within(1e-9, EARTH_FIELD.normalize(),
+                         q.rotate(magno.normalize()));
+    assert_vector_within(1e-9, Vector3(0, 0, ACCEL_SCALE),
+                         ins.get_accel_offset());
+}
+
+/**
+ * Without a magnetometer reading the heading is left alone
+ */
+void test_align_without_magno_levels_only(void) {
+    const Vector3 force(0.2, 0, 0.98);
+    InertialNavigationSystem ins = make_ins(force);
+    ins.align(force, Vector3(0, 0, 0));
+
+    const Quaternion q = ins.get_orientation();
+    assert_vector_within(1e-9, Vector3(0, 0, 1), q.rotate(force.normalize()));
+    TEST_ASSERT_DOUBLE_WITHIN(1e-9, 0, q.z());
+}
+
+/**
+ * The accel bias starts from the calibration, what it measured beyond
+ * gravity, rather than zero
+ */
+void test_error_state_seeded_from_calibration(void) {
+    const Vector3 force = BOARD.rotate_inverse(Vector3(0, 0, ACCEL_SCALE));
+    const Vector3 gyro(0, 0, 0);
+    InertialNavigationSystem ins = make_ins(force);
+    ins.align(force, BOARD.rotate_inverse(EARTH_FIELD));
+    ins.set_navigation_mode(NavigationMode::ERROR_STATE_KALMAN);
+
+    for (int i = 0; i < 208; i++) {
+        ins.update_position(gyro, force, BOARD.rotate_inverse(EARTH_FIELD));
+    }
+
+    // At rest and aligned, the seeded bias explains the whole reading
+    assert_vector_within(1e-6, Vector3(0, 0, 0), ins.get_velocity());
+    assert_vector_within(1e-6, Vector3(0, 0, 0), ins.get_position());
+    assert_vector_within(1e-6, Vector3(0, 0, ACCEL_SCALE),
+                         ins.get_accel_offset());
+}
+
+/**
+ * Starting from a zero gyro offset the zero rate measurements taken under
+ * ZUPT pull the bias in, while velocity is held rather than drifting off
+ * on the uncorrected rate
+ */
+void test_error_state_estimates_gyro_bias(void) {
+    const Vector3 force = BOARD.rotate_inverse(Vector3(0, 0, 1));
+    const Vector3 magno = BOARD.rotate_inverse(EARTH_FIELD);
+    InertialNavigationSystem ins = make_ins(force);
+    ins.align(force, magno);
+    ins.set_navigation_mode(NavigationMode::ERROR_STATE_KALMAN);
+
+    for (int i = 0; i < 10 * 208; i++) {
+        ins.add_sample(force * 9.8);
+        ins.update_position(GYRO_BIAS, force, magno);
+    }
+
+    assert_vector_within(1e-4, GYRO_BIAS, ins.get_gyro_offset());
+    assert_vector_within(0.01, Vector3(0, 0, 0), ins.get_velocity());
+    assert_vector_within(1e-3, Vector3(0, 0, 1), ins.get_accel_offset());
+}
+
+/**
+ * At one attitude only the accel bias along gravity can be told apart from
+ * tilt, so hold three poses with a turn between each. The filter starts
+ * with both biases at zero and sees ZUPT only while the board is held.
+ */
+void test_error_state_estimates_biases_over_three_poses(void) {
+    const double rate = M_PI / 2;  // a quarter turn per second
+    const Vector3 turns[3] = {Vector3(0, 0, 0), Vector3(rate, 0, 0),
+                              Vector3(0, rate, 0)};
+
+    Quaternion truth = BOARD;
+    ErrorStateKalmanFilter filter(truth, Vector3(0, 0, 0), Vector3(0, 0, 0),
+                                  Vector3(0, 0, 0), Vector3(0, 0, 0));
+    for (const Vector3& turn : turns) {
+        for (int i = 0; i < 208; i++) {
+            const Vector3 force =
+                truth.rotate_inverse(Vector3(0, 0, 9.8)) + ACCEL_BIAS;
+            filter.predict(turn + GYRO_BIAS, force, TIME_DELTA);
+            filter.update_heading(truth.rotate_inverse(EARTH_FIELD));
+            truth = (truth * Quaternion::axis_angle_to_quat(
+                                 turn.magnitude() * TIME_DELTA,
+                                 turn.magnitude() > 0 ? turn.normalize()
+                                                      : Vector3(1, 0, 0)))
+                        .normalize();
+        }
+        for (int i = 0; i < 5 * 208; i++) {
+            const Vector3 force =
+                truth.rotate_inverse(Vector3(0, 0, 9.8)) + ACCEL_BIAS;
+            filter.predict(GYRO_BIAS, force, TIME_DELTA);
+            filter.update_stationary(GYRO_BIAS);
+            filter.update_heading(truth.rotate_inverse(EARTH_FIELD));
+        }
+    }
+
+    assert_vector_within(1e-4, GYRO_BIAS, filter.get_gyro_bias());
+    assert_vector_within(5e-3, ACCEL_BIAS, filter.get_accel_bias());
+    assert_vector_within(0.01, Vector3(0, 0, 0), filter.get_velocity());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_align_recovers_orientation);
+    RUN_TEST(test_align_without_magno_levels_only);
+    RUN_TEST(test_error_state_seeded_from_calibration);
+    RUN_TEST(test_error_state_estimates_gyro_bias);
+    RUN_TEST(test_error_state_estimates_biases_over_three_poses);
+    return UNITY_END();
+}
@@ -0,0 +1,194 @@
+/**
+ * JSONWriter output against the JSONBuilder it replaced, byte for byte, and
+ * the time each takes to serialize a collect payload.
+*/
+#include <math.h>
+#include <string.h>
+#include <unity.h>
+
+#include <any>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../bench.h"
+#include "data/json.h"
+#include "data/json_writer.h"
+
+using namespace SimpleSlam;
+
+#define NUM_POINTS 64
+#define NUM_RANDOM_VALUES 100000
+
+static char buffer[8192];
+
+/** One value through JSONBuilder, as the only field of an object */
+template <typename T>
+static std::string build_value(const T& value) {
+    return JSON().add("v", value).build();
+}
+
+template <typename T>
+static std::string write_value(const T& value) {
+    JSONWriter writer(buffer, sizeof(buffer));
+    writer.begin_object().field("v", value).end_object();
+    TEST_ASSERT_TRUE(writer.ok());
+    return std::string(writer.c_str(), writer.size());
+}
+
+template <typename T>
+static void assert_same(const T& value) {
+    const std::string expected = build_value(value);
+    const std::string actual = write_value(value);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), actual.c_str());
+}
+
+static uint32_t seed = 1;
+
+static uint32_t next_random() {
+    seed = seed * 1664525 + 1013904223;
+    return seed;
+}
+
+static std::vector<Math::Vector2> make_points() {
+    std::vector<Math::Vector2> points;
+    for (int i = 0; i < NUM_POINTS; i++) {
+        points.push_back(Math::Vector2(i * 3.25 - 40, 1000.0 / (i + 1)));
+    }
+    return points;
+}
+
+/** The collect payload the way BufferedHTTPClient built it with JSON */
+static std::string build_payload(const std::vector<Math::Vector2>& points) {
+    std::vector<std::any> spatials;
+    std::vector<std::any> positions;
+    for (auto& point : points) {
+        spatials.push_back(std::vector<std::any>{point.get_x(), point.get_y()});
+        positions.push_back(std::vector<std::any>{point.get_y(), point.get_x()});
+    }
+    JSON data;
+    data.add("board_id", "b1").add("spatials", spatials).add("positions", positions);
+    return data.build();
+}
+
+/**
+ * The same payload through JSONWriter. JSON keeps fields in an
+ * unordered_map, so the keys go in whatever order it iterates them.
+ */
+static size_t write_payload(const std::vector<Math::Vector2>& points) {
+    const std::unordered_map<std::string, std::any> fields{
+        {"board_id", 0}, {"spatials", 0}, {"positions", 0}};
+    JSONWriter writer(buffer, sizeof(buffer));
+    writer.begin_object();
+    for (auto& field : fields) {
+        if (field.first == "board_id") {
+            writer.field("board_id", "b1");
+        } else if (field.first == "spatials") {
+            writer.key("spatials").array(points.data(), points.size());
+        } else {
+            writer.key("positions").array(
+                points.data(), points.size(), [](const Math::Vector2& point) {
+                    return Math::Vector2(point.get_y(), point.get_x());
+                });
+        }
+    }
+    writer.end_object();
+    return writer.ok() ? writer.size() : 0;
+}
+
+void setUp() {
+    Bench_Init();
+    seed = 1;
+}
+
+void tearDown() {}
+
+void test_numbers_match_builder() {
+    assert_same(0);
+    assert_same(-1);
+    assert_same(INT32_MAX);
+    assert_same(INT32_MIN);
+    assert_same(0.0f);
+    assert_same(-0.0f);
+    assert_same(0.5e-6f);
+    assert_same(1.5e-6f);
+    assert_same(2.5e-6f);
+    assert_same(123456.789f);
+    assert_same(8e12f);
+    assert_same(3.4e38f);
+    assert_same(-3.4e38f);
+    assert_same(INFINITY);
+    // Doubles are narrowed to float on both sides
+    assert_same(0.1);
+    assert_same(-1e300);
+    assert_same(1234567.891234);
+}
+
+void test_random_floats_match_builder() {
+    for (int i = 0; i < NUM_RANDOM_VALUES; i++) {
+        uint32_t bits = next_random();
+        float value;
+        memcpy(&value, &bits, sizeof(value));
+        if (value != value) {
+            continue;
+        }
+        const std::string expected = build_value(value);
+        const std::string actual = write_value(value);
+        if (expected != actual) {
+            TEST_ASSERT_EQUAL_STRING(expected.c_str(), actual.c_str());
+        }
+    }
+}
+
+void test_strings_match_builder() {
+    assert_same("");
+    assert_same("b1");
+    assert_same("say \"hi\"");
+    assert_same("back\\slash");
+    assert_same("tab\tand\nnewline");
+}
+
+void test_payload_matches_builder() {
+    const std::vector<Math::Vector2> points = make_points();
+    const std::string expected = build_payload(points);
+    const size_t size = write_payload(points);
+    TEST_ASSERT_EQUAL(expected.size(), size);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), buffer);
+}
+
+void test_bench_payload() {
+    const std::vector<Math::Vector2> points = make_points();
+    const uint32_t iterations = BENCH_ITERATIONS / NUM_POINTS + 1;
+
+    size_t total = 0;
+    bench_ticks_t start = Bench_Now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        total += build_payload(points).size();
+    }
+    const double builder_cost =
+        Bench_Report("JSONBuilder payload", Bench_Elapsed(start),
+                     iterations, "payload");
+
+    start = Bench_Now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        total += write_payload(points);
+    }
+    const double writer_cost =
+        Bench_Report("JSONWriter payload", Bench_Elapsed(start),
+                     iterations, "payload");
+
+    printf("%d points, builder / writer: %.1f\n", NUM_POINTS,
+           builder_cost / writer_cost);
+    TEST_ASSERT_TRUE(total > 0);
+    TEST_ASSERT_TRUE(writer_cost < builder_cost);
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_numbers_match_builder);
+    RUN_TEST(test_random_floats_match_builder);
+    RUN_TEST(test_strings_match_builder);
+    RUN_TEST(test_payload_matches_builder);
+    RUN_TEST(test_bench_payload);
+    return UNITY_END();
+}
@@ -0,0 +1,160 @@
+/**
+ * MagnetometerCalibrator against synthetic readings: the ellipsoid fit with
+ * a known hard and soft iron, the min/max fallback after turning about one
+ * axis, and too few readings to fit.
+*/
+#include <math.h>
+#include <unity.h>
+
+#include "math/conversion.h"
+#include "math/magnetometer_calibrator.h"
+
+using namespace SimpleSlam::Math;
+
+#define FIELD_RADIUS 450.0  // mgauss
+#define NUM_READINGS 400
+
+static const Vector3 HARD_IRON(120, -80, 45);
+// Symmetric soft iron, up to ~15% stretch off the axes
+static const double SOFT_IRON[3][3] = {
+    {1.10, 0.05, -0.03},
+    {0.05, 0.92, 0.04},
+    {-0.03, 0.04, 1.02},
+};
+
+static uint32_t noise_state;
+
+/** Repeatable uniform noise in [-amplitude, amplitude] */
+static double noise(double amplitude) {
+    noise_state = noise_state * 1664525 + 1013904223;
+    return amplitude * ((noise_state >> 8) / (double)(1 << 24) * 2 - 1);
+}
+
+/** A field of FIELD_RADIUS along direction as the distorted sensor reads it */
+static Vector3 distort(const Vector3& direction) {
+    const Vector3 field = direction.normalize() * FIELD_RADIUS;
+    double reading[3];
+    for (int i = 0; i < 3; i++) {
+        reading[i] = HARD_IRON[i] + noise(1);
+        for (int j = 0; j < 3; j++) {
+            reading[i] += SOFT_IRON[i][j] * field[j];
+        }
+    }
+    return Vector3(reading[0], reading[1], reading[2]);
+}
+
+/** Fibonacci sphere, directions spread evenly over every orientation */
+static Vector3 sphere_direction(int i, int count) {
+    const double z = 1 - (2 * i + 1) / (double)count;
+    const double r = sqrt(1 - z * z);
+    const double angle = i * M_PI * (3 - sqrt(5.0));
+    return Vector3(r * cos(angle), r * sin(angle), z);
+}
+
+void setUp() { noise_state = 1234; }
+
+void tearDown() {}
+
+/**
+ * The offset is the ellipsoid centre, and the soft iron maps the readings
+ * back onto a sphere of the ellipsoid's mean radius
+ */
+void test_ellipsoid_fit_corrects_to_constant_radius() {
+    MagnetometerCalibrator calibrator;
+    for (int i = 0; i < NUM_READINGS; i++) {
+        calibrator.add(distort(sphere_direction(i, NUM_READINGS)));
+    }
+    const magnetometer_calibration_t calibration = calibrator.solve();
+
+    // Min/max only ever gives a diagonal, so this was the fit
+    TEST_ASSERT_TRUE(fabs(calibration.soft_iron[0][1]) > 0.01);
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1.5, HARD_IRON[i], calibration.offset[i]);
+        // Symmetric, not an arbitrary rotation of the fix
+        for (int j = 0; j < i; j++) {
+            TEST_ASSERT_DOUBLE_WITHIN(1e-9, calibration.soft_iron[i][j],
+                                      calibration.soft_iron[j][i]);
+        }
+    }
+
+    // Fresh directions, not the ones fitted
+    double mean = 0;
+    double corrected[NUM_READINGS];
+    for (int i = 0; i < NUM_READINGS; i++) {
+        const Vector3 direction =
+            sphere_direction(i, NUM_READINGS) + Vector3(0.1, -0.2, 0.05);
+        corrected[i] =
+            Adjust_Magnetometer_Vector(distort(direction), calibration)
+                .magnitude();
+        mean += corrected[i] / NUM_READINGS;
+    }
+    for (int i = 0; i < NUM_READINGS; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(0.005 * mean, mean, corrected[i]);
+    }
+}
+
+/**
+ * Turned flat about z only, z never spans the field so the fit is refused.
+ * The fallback centres x and y, but z keeps no offset and unit scale since
+ * its midpoint would be the vertical earth field, not hard iron.
+ */
+void test_single_axis_turn_falls_back_to_min_max() {
+    MagnetometerCalibrator calibrator;
+    for (int i = 0; i < NUM_READINGS; i++) {
+        const double angle = 2 * M_PI * i / NUM_READINGS;
+        calibrator.add(
+            Vector3(HARD_IRON[0] + 200 * cos(angle) + noise(1),
+                    HARD_IRON[1] + 200 * sin(angle) + noise(1),
+                    HARD_IRON[2] - 400 + noise(1)));
+    }
+    const magnetometer_calibration_t calibration = calibrator.solve();
+
+    TEST_ASSERT_DOUBLE_WITHIN(1, HARD_IRON[0], calibration.offset[0]);
+    TEST_ASSERT_DOUBLE_WITHIN(1, HARD_IRON[1], calibration.offset[1]);
+    TEST_ASSERT_EQUAL_DOUBLE(0, calibration.offset[2]);
+    TEST_ASSERT_EQUAL_DOUBLE(1, calibration.soft_iron[2][2]);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            if (i != j) {
+                TEST_ASSERT_EQUAL_DOUBLE(0, calibration.soft_iron[i][j]);
+            }
+        }
+    }
+}
+
+/**
+ * Below the minimum the fit is not tried even though the readings cover
+ * every axis, min/max gives the offsets. With none at all the calibration
+ * is the identity.
+ */
+void test_too_few_readings_fall_back_to_min_max() {
+    MagnetometerCalibrator calibrator;
+    magnetometer_calibration_t calibration = calibrator.solve();
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_EQUAL_DOUBLE(0, calibration.offset[i]);
+        TEST_ASSERT_EQUAL_DOUBLE(1, calibration.soft_iron[i][i]);
+    }
+
+    // Both ends of every axis, too few for the nine fit parameters to be
+    // trusted
+    const Vector3 axes[6] = {Vector3(1, 0, 0),  Vector3(-1, 0, 0),
+                             Vector3(0, 1, 0),  Vector3(0, -1, 0),
+                             Vector3(0, 0, 1),  Vector3(0, 0, -1)};
+    for (const Vector3& axis : axes) {
+        calibrator.add(HARD_IRON + axis * FIELD_RADIUS);
+    }
+    TEST_ASSERT_EQUAL(6, calibrator.count());
+    calibration = calibrator.solve();
+    for (int i = 0; i < 3; i++) {
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, HARD_IRON[i], calibration.offset[i]);
+        TEST_ASSERT_DOUBLE_WITHIN(1e-9, 1, calibration.soft_iron[i][i]);
+    }
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_ellipsoid_fit_corrects_to_constant_radius);
+    RUN_TEST(test_single_axis_turn_falls_back_to_min_max);
+    RUN_TEST(test_too_few_readings_fall_back_to_min_max);
+    return UNITY_END();
+}
@@ -0,0 +1,120 @@
+/**
+ * PointBatchWriter output for each encoding. The batches match the fixtures
+ * decoded in server/internal/api/batch_test.go.
+*/
+#include <unity.h>
+
+#include "data/point_batch.h"
+
+using namespace SimpleSlam;
+
+static uint8_t buffer[256];
+
+static const uint8_t HEADER_TAIL[] = {0x02, 0x00, 0x40, 0xe2, 0x01, 0x00, 0x02, 0x62, 0x31};
+
+static PointBatchWriter write_fixture(PointEncoding encoding) {
+    PointBatchWriter writer(buffer, sizeof(buffer), encoding);
+    writer.header("b1", 123456, 2)
+        .point(Math::Vector2(1.24, -2.5))
+        .point(Math::Vector2(3.0, 400.6))
+        .point(Math::Vector2(-1.0, 0.0))
+        .point(Math::Vector2(70000.4, -0.4));
+    return writer;
+}
+
+static void assert_batch(const PointBatchWriter& writer, PointEncoding encoding,
+                         const uint8_t* pairs, size_t pairs_size) {
+    TEST_ASSERT_TRUE(writer.ok());
+    TEST_ASSERT_EQUAL(POINT_BATCH_HEADER_SIZE + 2 + pairs_size, writer.size());
+    TEST_ASSERT_EQUAL_MEMORY(POINT_BATCH_MAGIC, writer.data(), 4);
+    TEST_ASSERT_EQUAL(POINT_BATCH_VERSION, writer.data()[4]);
+    TEST_ASSERT_EQUAL((int)encoding, writer.data()[5]);
+    TEST_ASSERT_EQUAL_MEMORY(HEADER_TAIL, writer.data() + 6, sizeof(HEADER_TAIL));
+    TEST_ASSERT_EQUAL_MEMORY(pairs, writer.data() + POINT_BATCH_HEADER_SIZE + 2, pairs_size);
+}
+
+void setUp() {}
+
+void tearDown() {}
+
+void test_float32_batch() {
+    const uint8_t pairs[] = {
+        0x52, 0xb8, 0x9e, 0x3f, 0x00, 0x00, 0x20, 0xc0,
+        0x00, 0x00, 0x40, 0x40, 0xcd, 0x4c, 0xc8, 0x43,
+        0x00, 0x00, 0x80, 0xbf, 0x00, 0x00, 0x00, 0x00,
+        0x33, 0xb8, 0x88, 0x47, 0xcd, 0xcc, 0xcc, 0xbe,
+    };
+    assert_batch(write_fixture(PointEncoding::FLOAT32), PointEncoding::FLOAT32, pairs,
+                 sizeof(pairs));
+}
+
+/**
+ * Rounds half away from zero and saturates 70000cm at INT16_MAX
+ */
+void test_int16_batch() {
+    const uint8_t pairs[] = {
+        0x01, 0x00, 0xfd, 0xff, 0x03, 0x00, 0x91, 0x01,
+        0xff, 0xff, 0x00, 0x00, 0xff, 0x7f, 0x00, 0x00,
+    };
+    assert_batch(write_fixture(PointEncoding::INT16_CM), PointEncoding::INT16_CM, pairs,
+                 sizeof(pairs));
+}
+
+/**
+ * The positions stream starts from a keyframe, (-1, 0) is written as is
+ * and not as a delta from the last spatial point
+ */
+void test_delta_varint_keyframe_resets_per_stream() {
+    const uint8_t pairs[] = {
+        0x02, 0x05, 0x04, 0xa8, 0x06,
+        0x01, 0x00, 0xe2, 0xc5, 0x08, 0x00,
+    };
+    assert_batch(write_fixture(PointEncoding::DELTA_VARINT_CM),
+                 PointEncoding::DELTA_VARINT_CM, pairs, sizeof(pairs));
+}
+
+/**
+ * Values clamp just inside +-2^30 cm so the delta between any two stays
+ * inside int32, the largest swing takes the full 5 bytes
+ */
+void test_delta_varint_clamps_below_2_pow_30() {
+    PointBatchWriter writer(buffer, sizeof(buffer), PointEncoding::DELTA_VARINT_CM);
+    writer.header("b1", 0, 2)
+        .point(Math::Vector2(1e12, -1e12))
+        .point(Math::Vector2(-1e12, 1e12))
+        .point(Math::Vector2(0.0, 0.0))
+        .point(Math::Vector2(0.0, 0.0));
+    TEST_ASSERT_TRUE(writer.ok());
+
+    const uint8_t pairs[] = {
+        // Keyframe (2^30 - 1, -(2^30 - 1))
+        0xfe, 0xff, 0xff, 0xff, 0x07, 0xfd, 0xff, 0xff, 0xff, 0x07,
+        // Delta (-(2^31 - 2), 2^31 - 2)
+        0xfb, 0xff, 0xff, 0xff, 0x0f, 0xfc, 0xff, 0xff, 0xff, 0x0f,
+        0x00, 0x00, 0x00, 0x00,
+    };
+    TEST_ASSERT_EQUAL(POINT_BATCH_HEADER_SIZE + 2 + sizeof(pairs), writer.size());
+    TEST_ASSERT_EQUAL_MEMORY(pairs, writer.data() + POINT_BATCH_HEADER_SIZE + 2, sizeof(pairs));
+    TEST_ASSERT_TRUE(writer.size() <=
+                     PointBatchWriter::Max_Size(2, 2, PointEncoding::DELTA_VARINT_CM));
+}
+
+void test_overflow_and_short_batches_are_not_ok() {
+    PointBatchWriter small(buffer, POINT_BATCH_HEADER_SIZE + 2 + 4, PointEncoding::INT16_CM);
+    small.header("b1", 0, 1).point(Math::Vector2(1.0, 1.0)).point(Math::Vector2(1.0, 1.0));
+    TEST_ASSERT_FALSE(small.ok());
+
+    PointBatchWriter missing(buffer, sizeof(buffer), PointEncoding::INT16_CM);
+    missing.header("b1", 0, 1).point(Math::Vector2(1.0, 1.0));
+    TEST_ASSERT_FALSE(missing.ok());
+}
+
+int main() {
+    UNITY_BEGIN();
+    RUN_TEST(test_float32_batch);
+    RUN_TEST(test_int16_batch);
+    RUN_TEST(test_delta_varint_keyframe_resets_per_stream);
+    RUN_TEST(test_delta_varint_clamps_below_2_pow_30);
+    RUN_TEST(test_overflow_and_short_batches_are_not_ok);
+    return UNITY_END();
+}